@@ -148,6 +148,7 @@ from _duckdb import (
 	fetchdf,
 	fetch_df,
 	df,
+	fetch_numpy_batches,
 	fetch_df_chunk,
 	pl,
 	fetch_arrow_table,
@@ -228,6 +229,7 @@ _exported_symbols.extend([
 	'fetchdf',
 	'fetch_df',
 	'df',
+	'fetch_numpy_batches',
 	'fetch_df_chunk',
 	'pl',
 	'fetch_arrow_table',
@@ -46,7 +46,7 @@ from typing import Any, ClassVar, Set, Optional, Callable
 from io import StringIO, TextIOBase
 from pathlib import Path
 
-from typing import overload, Dict, List, Union, Tuple
+from typing import overload, Dict, List, Union, Tuple, Iterator
 import pandas
 # stubgen override - unfortunately we need this for version checks
 import sys
@@ -314,15 +314,16 @@ class DuckDBPyConnection:
     def fetchone(self) -> Optional[tuple]: ...
     def fetchmany(self, size: int = 1) -> List[Any]: ...
     def fetchall(self) -> List[Any]: ...
-    def fetchnumpy(self) -> dict: ...
-    def fetchdf(self, *, date_as_object: bool = False) -> pandas.DataFrame: ...
-    def fetch_df(self, *, date_as_object: bool = False) -> pandas.DataFrame: ...
-    def df(self, *, date_as_object: bool = False) -> pandas.DataFrame: ...
+    def fetchnumpy(self, *, arrays_2d: bool = False, decimal_as: str = "float") -> dict: ...
+    def fetchdf(self, *, date_as_object: bool = False, categorical_strings: bool = False) -> pandas.DataFrame: ...
+    def fetch_df(self, *, date_as_object: bool = False, categorical_strings: bool = False) -> pandas.DataFrame: ...
+    def df(self, *, date_as_object: bool = False, categorical_strings: bool = False) -> pandas.DataFrame: ...
+    def fetch_numpy_batches(self, batch_size: int, *, reuse_buffers: bool = False) -> Iterator[dict]: ...
     def fetch_df_chunk(self, vectors_per_chunk: int = 1, *, date_as_object: bool = False) -> pandas.DataFrame: ...
     def pl(self, rows_per_batch: int = 1000000, *, lazy: bool = False) -> polars.DataFrame: ...
     def fetch_arrow_table(self, rows_per_batch: int = 1000000) -> pyarrow.lib.Table: ...
-    def fetch_record_batch(self, rows_per_batch: int = 1000000) -> pyarrow.lib.RecordBatchReader: ...
-    def arrow(self, rows_per_batch: int = 1000000) -> pyarrow.lib.RecordBatchReader: ...
+    def fetch_record_batch(self, rows_per_batch: int = 1000000, *, prefetch_batches: int = 0) -> pyarrow.lib.RecordBatchReader: ...
+    def arrow(self, rows_per_batch: int = 1000000, *, prefetch_batches: int = 0) -> pyarrow.lib.RecordBatchReader: ...
     def torch(self) -> dict: ...
     def tf(self) -> dict: ...
     def begin(self) -> DuckDBPyConnection: ...
@@ -415,7 +416,7 @@ class DuckDBPyRelation:
     def variance(self, column: str, groups: str = ..., window_spec: str = ..., projected_columns: str = ...) -> DuckDBPyRelation: ...
     def list(self, column: str, groups: str = ..., window_spec: str = ..., projected_columns: str = ...) -> DuckDBPyRelation: ...
 
-    def arrow(self, batch_size: int = ...) -> pyarrow.lib.RecordBatchReader: ...
+    def arrow(self, batch_size: int = ..., *, prefetch_batches: int = ...) -> pyarrow.lib.RecordBatchReader: ...
     def __arrow_c_stream__(self, requested_schema: Optional[object] = None) -> object: ...
     def create(self, table_name: str) -> None: ...
     def create_view(self, view_name: str, replace: bool = ...) -> DuckDBPyRelation: ...
@@ -427,10 +428,10 @@ class DuckDBPyRelation:
     def explain(self, type: Optional[Literal['standard', 'analyze'] | int] = 'standard') -> str: ...
     def fetchall(self) -> List[Any]: ...
     def fetchmany(self, size: int = ...) -> List[Any]: ...
-    def fetchnumpy(self) -> dict: ...
+    def fetchnumpy(self, *, arrays_2d: bool = False, decimal_as: str = "float") -> dict: ...
     def fetchone(self) -> Optional[tuple]: ...
     def fetchdf(self, *args, **kwargs) -> Any: ...
-    def fetch_arrow_reader(self, batch_size: int = ...) -> pyarrow.lib.RecordBatchReader: ...
+    def fetch_arrow_reader(self, batch_size: int = ..., *, prefetch_batches: int = ...) -> pyarrow.lib.RecordBatchReader: ...
     def fetch_arrow_table(self, rows_per_batch: int = ...) -> pyarrow.lib.Table: ...
     def filter(self, filter_expr: Union[Expression, str]) -> DuckDBPyRelation: ...
     def insert(self, values: List[Any]) -> None: ...
@@ -448,7 +449,7 @@ class DuckDBPyRelation:
     def pl(self, rows_per_batch: int = ..., connection: DuckDBPyConnection = ...) -> polars.DataFrame: ...
     def query(self, virtual_table_name: str, sql_query: str) -> DuckDBPyRelation: ...
     def record_batch(self, batch_size: int = ...) -> pyarrow.lib.RecordBatchReader: ...
-    def fetch_record_batch(self, rows_per_batch: int = 1000000, *, connection: DuckDBPyConnection = ...) -> pyarrow.lib.RecordBatchReader: ...
+    def fetch_record_batch(self, rows_per_batch: int = 1000000, *, prefetch_batches: int = 0) -> pyarrow.lib.RecordBatchReader: ...
     def select_types(self, types: List[Union[str, DuckDBPyType]]) -> DuckDBPyRelation: ...
     def select_dtypes(self, types: List[Union[str, DuckDBPyType]]) -> DuckDBPyRelation: ...
     def set_alias(self, alias: str) -> DuckDBPyRelation: ...
@@ -489,6 +490,7 @@ class DuckDBPyRelation:
             use_tmp_file: Optional[bool] = None,
             append: Optional[bool] = None
     ) -> None: ...
+    def fetch_numpy_batches(self, batch_size: int, *, reuse_buffers: bool = False) -> Iterator[dict]: ...
     def fetch_df_chunk(self, vectors_per_chunk: int = 1, *, date_as_object: bool = False) -> pandas.DataFrame: ...
     def to_table(self, table_name: str) -> None: ...
     def to_view(self, view_name: str, replace: bool = ...) -> DuckDBPyRelation: ...
@@ -663,15 +665,16 @@ def query_progress(*, connection: DuckDBPyConnection = ...) -> float: ...
 def fetchone(*, connection: DuckDBPyConnection = ...) -> Optional[tuple]: ...
 def fetchmany(size: int = 1, *, connection: DuckDBPyConnection = ...) -> List[Any]: ...
 def fetchall(*, connection: DuckDBPyConnection = ...) -> List[Any]: ...
-def fetchnumpy(*, connection: DuckDBPyConnection = ...) -> dict: ...
-def fetchdf(*, date_as_object: bool = False, connection: DuckDBPyConnection = ...) -> pandas.DataFrame: ...
-def fetch_df(*, date_as_object: bool = False, connection: DuckDBPyConnection = ...) -> pandas.DataFrame: ...
-def df(*, date_as_object: bool = False, connection: DuckDBPyConnection = ...) -> pandas.DataFrame: ...
+def fetchnumpy(*, arrays_2d: bool = False, decimal_as: str = "float", connection: DuckDBPyConnection = ...) -> dict: ...
+def fetchdf(*, date_as_object: bool = False, categorical_strings: bool = False, connection: DuckDBPyConnection = ...) -> pandas.DataFrame: ...
+def fetch_df(*, date_as_object: bool = False, categorical_strings: bool = False, connection: DuckDBPyConnection = ...) -> pandas.DataFrame: ...
+def df(*, date_as_object: bool = False, categorical_strings: bool = False, connection: DuckDBPyConnection = ...) -> pandas.DataFrame: ...
+def fetch_numpy_batches(batch_size: int, *, reuse_buffers: bool = False, connection: DuckDBPyConnection = ...) -> Iterator[dict]: ...
 def fetch_df_chunk(vectors_per_chunk: int = 1, *, date_as_object: bool = False, connection: DuckDBPyConnection = ...) -> pandas.DataFrame: ...
 def pl(rows_per_batch: int = 1000000, *, lazy: bool = False, connection: DuckDBPyConnection = ...) -> polars.DataFrame: ...
 def fetch_arrow_table(rows_per_batch: int = 1000000, *, connection: DuckDBPyConnection = ...) -> pyarrow.lib.Table: ...
-def fetch_record_batch(rows_per_batch: int = 1000000, *, connection: DuckDBPyConnection = ...) -> pyarrow.lib.RecordBatchReader: ...
-def arrow(rows_per_batch: int = 1000000, *, connection: DuckDBPyConnection = ...) -> pyarrow.lib.RecordBatchReader: ...
+def fetch_record_batch(rows_per_batch: int = 1000000, *, prefetch_batches: int = 0, connection: DuckDBPyConnection = ...) -> pyarrow.lib.RecordBatchReader: ...
+def arrow(rows_per_batch: int = 1000000, *, prefetch_batches: int = 0, connection: DuckDBPyConnection = ...) -> pyarrow.lib.RecordBatchReader: ...
 def torch(*, connection: DuckDBPyConnection = ...) -> dict: ...
 def tf(*, connection: DuckDBPyConnection = ...) -> dict: ...
 def begin(*, connection: DuckDBPyConnection = ...) -> DuckDBPyConnection: ...
@@ -0,0 +1,33 @@
+# Compares the chunk-at-a-time fetchall against a per-row fetchone loop on a mixed-type table
+# Usage: python3 scripts/benchmark_fetch_rows.py [rows]
+import sys
+import time
+
+import duckdb
+
+rows = int(sys.argv[1]) if len(sys.argv) > 1 else 1000000
+
+con = duckdb.connect()
+con.execute(
+    f"""
+    CREATE TABLE bench AS
+    SELECT
+        i AS i, i / 7 AS d, i::VARCHAR AS s, i % 2 = 0 AS b,
+        DATE '2000-01-01' + (i % 10000)::INTEGER AS dt,
+        CASE WHEN i % 5 = 0 THEN NULL ELSE i END AS n
+    FROM range({rows}) t(i)
+    """
+)
+query = 'SELECT * FROM bench ORDER BY i'
+
+start = time.perf_counter()
+con.execute(query)
+while con.fetchone() is not None:
+    pass
+fetchone_time = time.perf_counter() - start
+
+start = time.perf_counter()
+con.execute(query).fetchall()
+fetchall_time = time.perf_counter() - start
+
+print(f"{rows} rows: fetchone loop {fetchone_time:.3f}s, fetchall {fetchall_time:.3f}s")
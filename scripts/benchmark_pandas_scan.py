@@ -0,0 +1,32 @@
+# Times scanning a wide float64 DataFrame where a small fraction of the values is NaN
+# Usage: python3 scripts/benchmark_pandas_scan.py [rows] [columns]
+import sys
+import time
+
+import duckdb
+import numpy as np
+import pandas as pd
+
+rows = int(sys.argv[1]) if len(sys.argv) > 1 else 1000000
+columns = int(sys.argv[2]) if len(sys.argv) > 2 else 50
+runs = 5
+
+rng = np.random.default_rng(42)
+data = {}
+for i in range(columns):
+    column = rng.random(rows)
+    column[rng.choice(rows, size=rows // 1000, replace=False)] = np.nan
+    data[f'c{i}'] = column
+df = pd.DataFrame(data)
+# Built from a row-major 2D array, the columns of this frame are strided views
+strided_df = pd.DataFrame(np.column_stack(list(data.values())), columns=list(data))
+
+con = duckdb.connect()
+query = 'SELECT ' + ', '.join(f'COUNT(c{i})' for i in range(columns))
+for name, frame in [('contiguous', df), ('strided', strided_df)]:
+    timings = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        con.sql(f'{query} FROM frame').fetchone()
+        timings.append(time.perf_counter() - start)
+    print(f"{name}: {columns} columns x {rows} rows, best of {runs}: {min(timings):.3f}s")
@@ -28,6 +28,9 @@ pandas.Int32Dtype
 pandas.Int64Dtype
 pandas.Float32Dtype
 pandas.Float64Dtype
+pandas.DatetimeIndex
+pandas.arrays.BooleanArray
+pandas.arrays.IntegerArray
 
 import datetime
 
@@ -116,6 +119,7 @@ typing._UnionGenericAlias
 import uuid
 
 uuid.UUID
+uuid.SafeUUID.unknown
 
 import collections
 import collections.abc
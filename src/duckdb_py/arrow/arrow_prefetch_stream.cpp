@@ -0,0 +1,168 @@
+#include "duckdb_python/arrow/arrow_prefetch_stream.hpp"
+#include "duckdb_python/pybind11/pybind_wrapper.hpp"
+
+namespace duckdb {
+
+//! The source stream may need the GIL to make progress (e.g. when scanning a pandas DataFrame),
+//! so the GIL can not be held while waiting on the background thread
+template <class FUNC>
+static void WaitWithoutGIL(FUNC &&func) {
+	if (Py_IsInitialized() && PyGILState_Check()) {
+		py::gil_scoped_release release;
+		func();
+	} else {
+		func();
+	}
+}
+
+static string GetSourceError(ArrowArrayStream &source) {
+	auto error = source.get_last_error(&source);
+	return error ? error : "Unknown error in the source ArrowArrayStream";
+}
+
+PrefetchArrowArrayStreamWrapper::PrefetchArrowArrayStreamWrapper(ArrowArrayStream source_p, idx_t depth)
+    : source(source_p), depth(depth) {
+	D_ASSERT(depth > 0);
+	D_ASSERT(source.release);
+	stream.private_data = this;
+	stream.get_schema = GetSchema;
+	stream.get_next = GetNext;
+	stream.get_last_error = GetLastError;
+	stream.release = Release;
+	producer = thread([this]() { Produce(); });
+}
+
+PrefetchArrowArrayStreamWrapper::~PrefetchArrowArrayStreamWrapper() {
+	Stop();
+	while (!batches.empty()) {
+		auto &array = batches.front();
+		if (array.release) {
+			array.release(&array);
+		}
+		batches.pop();
+	}
+	if (source.release) {
+		source.release(&source);
+	}
+}
+
+ArrowArrayStream PrefetchArrowArrayStreamWrapper::Create(ArrowArrayStream source, idx_t depth) {
+	// The wrapper is part of the 'private_data' of the returned stream, it is destroyed when that stream is released
+	auto wrapper = new PrefetchArrowArrayStreamWrapper(source, depth);
+	return wrapper->stream;
+}
+
+void PrefetchArrowArrayStreamWrapper::Produce() {
+	while (true) {
+		{
+			unique_lock<mutex> guard(lock);
+			batch_consumed.wait(guard, [&]() { return stopped || batches.size() < depth; });
+			if (stopped) {
+				return;
+			}
+		}
+		ArrowArray array;
+		int result;
+		string error;
+		{
+			lock_guard<mutex> source_guard(source_lock);
+			result = source.get_next(&source, &array);
+			if (result != 0) {
+				error = GetSourceError(source);
+			}
+		}
+
+		lock_guard<mutex> guard(lock);
+		if (result != 0) {
+			error_code = result;
+			last_error = std::move(error);
+			finished = true;
+			batch_produced.notify_all();
+			return;
+		}
+		if (!array.release) {
+			// The source is exhausted
+			finished = true;
+			batch_produced.notify_all();
+			return;
+		}
+		if (stopped) {
+			array.release(&array);
+			return;
+		}
+		batches.push(array);
+		batch_produced.notify_all();
+	}
+}
+
+void PrefetchArrowArrayStreamWrapper::Stop() {
+	{
+		lock_guard<mutex> guard(lock);
+		stopped = true;
+	}
+	batch_consumed.notify_all();
+	if (producer.joinable()) {
+		WaitWithoutGIL([&]() { producer.join(); });
+	}
+}
+
+int PrefetchArrowArrayStreamWrapper::GetSchema(ArrowArrayStream *stream, ArrowSchema *out) {
+	if (!stream->release) {
+		return -1;
+	}
+	auto &wrapper = *reinterpret_cast<PrefetchArrowArrayStreamWrapper *>(stream->private_data);
+	int result;
+	WaitWithoutGIL([&]() {
+		lock_guard<mutex> source_guard(wrapper.source_lock);
+		result = wrapper.source.get_schema(&wrapper.source, out);
+		if (result != 0) {
+			auto error = GetSourceError(wrapper.source);
+			lock_guard<mutex> guard(wrapper.lock);
+			wrapper.last_error = std::move(error);
+		}
+	});
+	return result;
+}
+
+int PrefetchArrowArrayStreamWrapper::GetNext(ArrowArrayStream *stream, ArrowArray *out) {
+	if (!stream->release) {
+		return -1;
+	}
+	auto &wrapper = *reinterpret_cast<PrefetchArrowArrayStreamWrapper *>(stream->private_data);
+	int result = 0;
+	WaitWithoutGIL([&]() {
+		unique_lock<mutex> guard(wrapper.lock);
+		wrapper.batch_produced.wait(guard, [&]() { return !wrapper.batches.empty() || wrapper.finished; });
+		if (!wrapper.batches.empty()) {
+			*out = wrapper.batches.front();
+			wrapper.batches.pop();
+			wrapper.batch_consumed.notify_all();
+			return;
+		}
+		// Only report the error once all batches produced before it have been consumed
+		result = wrapper.error_code;
+		if (result == 0) {
+			out->release = nullptr;
+		}
+	});
+	return result;
+}
+
+const char *PrefetchArrowArrayStreamWrapper::GetLastError(ArrowArrayStream *stream) {
+	if (!stream->release) {
+		return "stream was released";
+	}
+	auto &wrapper = *reinterpret_cast<PrefetchArrowArrayStreamWrapper *>(stream->private_data);
+	lock_guard<mutex> guard(wrapper.lock);
+	return wrapper.last_error.c_str();
+}
+
+void PrefetchArrowArrayStreamWrapper::Release(ArrowArrayStream *stream) {
+	if (!stream || !stream->release) {
+		return;
+	}
+	stream->release = nullptr;
+	delete reinterpret_cast<PrefetchArrowArrayStreamWrapper *>(stream->private_data);
+}
+
+} // namespace duckdb
@@ -358,43 +358,54 @@ static void InitializeConnectionMethods(py::module_ &m) {
 	    "Fetch all rows from a result following execute", py::kw_only(), py::arg("connection") = py::none());
 	m.def(
 	    "fetchnumpy",
-	    [](shared_ptr<DuckDBPyConnection> conn = nullptr) {
+	    [](bool arrays_2d, const string &decimal_as, shared_ptr<DuckDBPyConnection> conn = nullptr) {
 		    if (!conn) {
 			    conn = DuckDBPyConnection::DefaultConnection();
 		    }
-		    return conn->FetchNumpy();
+		    return conn->FetchNumpy(arrays_2d, decimal_as);
 	    },
-	    "Fetch a result as list of NumPy arrays following execute", py::kw_only(), py::arg("connection") = py::none());
+	    "Fetch a result as list of NumPy arrays following execute", py::kw_only(), py::arg("arrays_2d") = false,
+	    py::arg("decimal_as") = "float", py::arg("connection") = py::none());
 	m.def(
 	    "fetchdf",
-	    [](bool date_as_object, shared_ptr<DuckDBPyConnection> conn = nullptr) {
+	    [](bool date_as_object, bool categorical_strings, shared_ptr<DuckDBPyConnection> conn = nullptr) {
 		    if (!conn) {
 			    conn = DuckDBPyConnection::DefaultConnection();
 		    }
-		    return conn->FetchDF(date_as_object);
+		    return conn->FetchDF(date_as_object, categorical_strings);
 	    },
 	    "Fetch a result as DataFrame following execute()", py::kw_only(), py::arg("date_as_object") = false,
-	    py::arg("connection") = py::none());
+	    py::arg("categorical_strings") = false, py::arg("connection") = py::none());
 	m.def(
 	    "fetch_df",
-	    [](bool date_as_object, shared_ptr<DuckDBPyConnection> conn = nullptr) {
+	    [](bool date_as_object, bool categorical_strings, shared_ptr<DuckDBPyConnection> conn = nullptr) {
 		    if (!conn) {
 			    conn = DuckDBPyConnection::DefaultConnection();
 		    }
-		    return conn->FetchDF(date_as_object);
+		    return conn->FetchDF(date_as_object, categorical_strings);
 	    },
 	    "Fetch a result as DataFrame following execute()", py::kw_only(), py::arg("date_as_object") = false,
-	    py::arg("connection") = py::none());
+	    py::arg("categorical_strings") = false, py::arg("connection") = py::none());
 	m.def(
 	    "df",
-	    [](bool date_as_object, shared_ptr<DuckDBPyConnection> conn = nullptr) {
+	    [](bool date_as_object, bool categorical_strings, shared_ptr<DuckDBPyConnection> conn = nullptr) {
 		    if (!conn) {
 			    conn = DuckDBPyConnection::DefaultConnection();
 		    }
-		    return conn->FetchDF(date_as_object);
+		    return conn->FetchDF(date_as_object, categorical_strings);
 	    },
 	    "Fetch a result as DataFrame following execute()", py::kw_only(), py::arg("date_as_object") = false,
-	    py::arg("connection") = py::none());
+	    py::arg("categorical_strings") = false, py::arg("connection") = py::none());
+	m.def(
+	    "fetch_numpy_batches",
+	    [](idx_t batch_size, bool reuse_buffers, shared_ptr<DuckDBPyConnection> conn = nullptr) {
+		    if (!conn) {
+			    conn = DuckDBPyConnection::DefaultConnection();
+		    }
+		    return conn->FetchNumpyBatches(batch_size, reuse_buffers);
+	    },
+	    "Fetch the result as an iterator of dicts of NumPy arrays of 'batch_size' rows following execute()",
+	    py::arg("batch_size"), py::kw_only(), py::arg("reuse_buffers") = false, py::arg("connection") = py::none());
 	m.def(
 	    "fetch_df_chunk",
 	    [](const idx_t vectors_per_chunk = 1, bool date_as_object = false,
@@ -428,24 +439,24 @@ static void InitializeConnectionMethods(py::module_ &m) {
 	    py::arg("connection") = py::none());
 	m.def(
 	    "fetch_record_batch",
-	    [](const idx_t rows_per_batch, shared_ptr<DuckDBPyConnection> conn = nullptr) {
+	    [](const idx_t rows_per_batch, const idx_t prefetch_batches, shared_ptr<DuckDBPyConnection> conn = nullptr) {
 		    if (!conn) {
 			    conn = DuckDBPyConnection::DefaultConnection();
 		    }
-		    return conn->FetchRecordBatchReader(rows_per_batch);
+		    return conn->FetchRecordBatchReader(rows_per_batch, prefetch_batches);
 	    },
 	    "Fetch an Arrow RecordBatchReader following execute()", py::arg("rows_per_batch") = 1000000, py::kw_only(),
-	    py::arg("connection") = py::none());
+	    py::arg("prefetch_batches") = 0, py::arg("connection") = py::none());
 	m.def(
 	    "arrow",
-	    [](const idx_t rows_per_batch, shared_ptr<DuckDBPyConnection> conn = nullptr) {
+	    [](const idx_t rows_per_batch, const idx_t prefetch_batches, shared_ptr<DuckDBPyConnection> conn = nullptr) {
 		    if (!conn) {
 			    conn = DuckDBPyConnection::DefaultConnection();
 		    }
-		    return conn->FetchRecordBatchReader(rows_per_batch);
+		    return conn->FetchRecordBatchReader(rows_per_batch, prefetch_batches);
 	    },
 	    "Fetch an Arrow RecordBatchReader following execute()", py::arg("rows_per_batch") = 1000000, py::kw_only(),
-	    py::arg("connection") = py::none());
+	    py::arg("prefetch_batches") = 0, py::arg("connection") = py::none());
 	m.def(
 	    "torch",
 	    [](shared_ptr<DuckDBPyConnection> conn = nullptr) {
@@ -948,14 +959,14 @@ static void InitializeConnectionMethods(py::module_ &m) {
 	    py::arg("connection") = py::none());
 	m.def(
 	    "df",
-	    [](bool date_as_object, shared_ptr<DuckDBPyConnection> conn) -> PandasDataFrame {
+	    [](bool date_as_object, bool categorical_strings, shared_ptr<DuckDBPyConnection> conn) -> PandasDataFrame {
 		    if (!conn) {
 			    conn = DuckDBPyConnection::DefaultConnection();
 		    }
-		    return conn->FetchDF(date_as_object);
+		    return conn->FetchDF(date_as_object, categorical_strings);
 	    },
 	    "Fetch a result as DataFrame following execute()", py::kw_only(), py::arg("date_as_object") = false,
-	    py::arg("connection") = py::none());
+	    py::arg("categorical_strings") = false, py::arg("connection") = py::none());
 	m.def(
 	    "df",
 	    [](const PandasDataFrame &value, shared_ptr<DuckDBPyConnection> conn) -> unique_ptr<DuckDBPyRelation> {
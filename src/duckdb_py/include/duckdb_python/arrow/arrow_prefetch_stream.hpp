@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb_python/arrow/arrow_prefetch_stream.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/arrow/arrow_wrapper.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/queue.hpp"
+#include "duckdb/common/string.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
+
+namespace duckdb {
+
+//! Wraps an ArrowArrayStream, a background thread keeps up to 'depth' arrays of the source stream ready
+//! so producing the next batch overlaps with the consumer processing the current one
+class PrefetchArrowArrayStreamWrapper {
+public:
+	PrefetchArrowArrayStreamWrapper(ArrowArrayStream source, idx_t depth);
+	~PrefetchArrowArrayStreamWrapper();
+
+public:
+	//! Takes ownership of 'source', the returned stream owns the created wrapper
+	static ArrowArrayStream Create(ArrowArrayStream source, idx_t depth);
+
+public:
+	ArrowArrayStream stream;
+
+private:
+	//! Runs on the background thread, fills 'batches' until the source is exhausted or the stream is released
+	void Produce();
+	//! Stop the background thread and wait for it to finish
+	void Stop();
+
+	static int GetSchema(ArrowArrayStream *stream, ArrowSchema *out);
+	static int GetNext(ArrowArrayStream *stream, ArrowArray *out);
+	static const char *GetLastError(ArrowArrayStream *stream);
+	static void Release(ArrowArrayStream *stream);
+
+private:
+	ArrowArrayStream source;
+	idx_t depth;
+	//! Serializes the calls into 'source', which is not thread-safe
+	mutex source_lock;
+
+	//! Protects the state below
+	mutex lock;
+	std::condition_variable batch_produced;
+	std::condition_variable batch_consumed;
+	queue<ArrowArray> batches;
+	bool finished = false;
+	bool stopped = false;
+	int error_code = 0;
+	string last_error;
+
+	thread producer;
+};
+
+} // namespace duckdb
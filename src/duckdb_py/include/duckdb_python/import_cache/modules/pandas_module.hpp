@@ -20,6 +20,20 @@
 
 namespace duckdb {
 
+struct PandasArraysCacheItem : public PythonImportCacheItem {
+
+public:
+	PandasArraysCacheItem(optional_ptr<PythonImportCacheItem> parent)
+	    : PythonImportCacheItem("arrays", parent), BooleanArray("BooleanArray", this),
+	      IntegerArray("IntegerArray", this) {
+	}
+	~PandasArraysCacheItem() override {
+	}
+
+	PythonImportCacheItem BooleanArray;
+	PythonImportCacheItem IntegerArray;
+};
+
 struct PandasCacheItem : public PythonImportCacheItem {
 
 public:
@@ -33,7 +47,7 @@ public:
 	      UInt8Dtype("UInt8Dtype", this), UInt16Dtype("UInt16Dtype", this), UInt32Dtype("UInt32Dtype", this),
 	      UInt64Dtype("UInt64Dtype", this), Int8Dtype("Int8Dtype", this), Int16Dtype("Int16Dtype", this),
 	      Int32Dtype("Int32Dtype", this), Int64Dtype("Int64Dtype", this), Float32Dtype("Float32Dtype", this),
-	      Float64Dtype("Float64Dtype", this) {
+	      Float64Dtype("Float64Dtype", this), DatetimeIndex("DatetimeIndex", this), arrays(this) {
 	}
 	~PandasCacheItem() override {
 	}
@@ -57,6 +71,8 @@ public:
 	PythonImportCacheItem Int64Dtype;
 	PythonImportCacheItem Float32Dtype;
 	PythonImportCacheItem Float64Dtype;
+	PythonImportCacheItem DatetimeIndex;
+	PandasArraysCacheItem arrays;
 
 protected:
 	bool IsRequired() const override final {
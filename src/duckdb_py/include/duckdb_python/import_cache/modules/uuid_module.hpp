@@ -20,18 +20,31 @@
 
 namespace duckdb {
 
+struct UuidSafeUUIDCacheItem : public PythonImportCacheItem {
+
+public:
+	UuidSafeUUIDCacheItem(optional_ptr<PythonImportCacheItem> parent)
+	    : PythonImportCacheItem("SafeUUID", parent), unknown("unknown", this) {
+	}
+	~UuidSafeUUIDCacheItem() override {
+	}
+
+	PythonImportCacheItem unknown;
+};
+
 struct UuidCacheItem : public PythonImportCacheItem {
 
 public:
 	static constexpr const char *Name = "uuid";
 
 public:
-	UuidCacheItem() : PythonImportCacheItem("uuid"), UUID("UUID", this) {
+	UuidCacheItem() : PythonImportCacheItem("uuid"), UUID("UUID", this), SafeUUID(this) {
 	}
 	~UuidCacheItem() override {
 	}
 
 	PythonImportCacheItem UUID;
+	UuidSafeUUIDCacheItem SafeUUID;
 };
 
 } // namespace duckdb
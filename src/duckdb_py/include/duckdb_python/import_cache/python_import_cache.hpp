@@ -12,10 +12,30 @@
 #include "duckdb_python/pybind11/pybind_wrapper.hpp"
 #include "duckdb.hpp"
 #include "duckdb/common/vector.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb_python/import_cache/python_import_cache_modules.hpp"
 
 namespace duckdb {
 
+//! A (pytz) time zone, with what is needed to convert UTC timestamps to it
+struct PythonTimeZone {
+	py::object tzinfo;
+	//! Set when the time zone has a single offset from UTC (e.g. UTC or Etc/GMT+5), which is 'utc_offset_micros'
+	bool has_fixed_offset = false;
+	int64_t utc_offset_micros = 0;
+};
+
+//! The ENUM type created from the categories of a pandas Categorical
+struct PythonEnumType {
+	//! Weak reference to the categories (a pandas Index), its callback removes the entry when the Index is destroyed
+	py::object categories;
+	//! The length and the data buffer of the categories when the type was created
+	idx_t size = 0;
+	const void *data = nullptr;
+	LogicalType type;
+};
+
 struct PythonImportCache {
 public:
 	explicit PythonImportCache() {
@@ -41,9 +61,16 @@ public:
 
 public:
 	py::handle AddCache(py::object item);
+	//! The time zone with the given name, which is only looked up the first time it is requested
+	const PythonTimeZone &GetTimeZone(const string &name);
+	//! The ENUM type created earlier from 'categories' (if any)
+	optional_ptr<const LogicalType> GetEnumType(py::handle categories);
+	void AddEnumType(py::handle categories, LogicalType type);
 
 private:
 	vector<py::object> owned_objects;
+	unordered_map<string, PythonTimeZone> time_zones;
+	unordered_map<PyObject *, PythonEnumType> enum_types;
 };
 
 } // namespace duckdb
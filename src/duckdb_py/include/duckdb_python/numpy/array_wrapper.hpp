@@ -12,6 +12,8 @@
 #include "duckdb_python/numpy/raw_array_wrapper.hpp"
 #include "duckdb.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/string_map_set.hpp"
+#include "duckdb/common/types/string_heap.hpp"
 
 namespace duckdb {
 
@@ -38,21 +40,71 @@ public:
 	bool pandas = false;
 };
 
+//! Reuses the Python str objects of strings that were converted before in the same column
+struct NumpyStringCache {
+public:
+	//! Once this many distinct strings have been seen the column is unlikely to be low-cardinality, caching stops
+	static constexpr const idx_t MAX_ENTRIES = 4096;
+
+public:
+	//! Returns a new reference to the str object of 'val'
+	PyObject *Convert(string_t val);
+
+private:
+	bool enabled = true;
+	StringHeap heap;
+	string_map_t<py::object> entries;
+};
+
+//! Maps the strings of a VARCHAR column to categorical codes, the categories are collected in order of appearance
+struct NumpyStringCategories {
+public:
+	//! Returns the code of 'val', adding it to the categories when it was not seen before
+	int32_t GetCode(string_t val);
+
+public:
+	py::list categories;
+
+private:
+	StringHeap heap;
+	string_map_t<int32_t> codes;
+};
+
 struct ArrayWrapper {
-	explicit ArrayWrapper(const LogicalType &type, const ClientProperties &client_properties, bool pandas = false);
+	//! With 'arrays_2d' ARRAY columns of fixed-width types are converted to a (rows, size) array of the child type
+	//! With 'decimal_as_integer' DECIMAL columns are converted to their unscaled integers
+	explicit ArrayWrapper(const LogicalType &type, const ClientProperties &client_properties, bool pandas = false,
+	                      bool categorical_strings = false, bool arrays_2d = false, bool decimal_as_integer = false);
 
 	unique_ptr<RawArrayWrapper> data;
 	unique_ptr<RawArrayWrapper> mask;
 	bool requires_mask;
 	const ClientProperties client_properties;
 	bool pandas;
+	//! Only set for VARCHAR columns
+	unique_ptr<NumpyStringCache> string_cache;
+	//! Only set for VARCHAR columns that are converted to categorical codes, 'data' then holds the (int32) codes
+	unique_ptr<NumpyStringCategories> string_categories;
+	//! Only set for DECIMAL columns that are converted to their unscaled integers, 'data' then holds the integers
+	//! (as Python ints for the widest DECIMAL types)
+	bool decimal_as_integer = false;
 
 public:
 	void Initialize(idx_t capacity);
 	void Resize(idx_t new_capacity);
 	void Append(idx_t current_offset, Vector &input, idx_t source_size, idx_t source_offset = 0,
 	            idx_t count = DConstants::INVALID_INDEX);
+	//! Convert 'count' values of the input into the arrays at 'current_offset', without updating the counts
+	//! Returns whether any of the converted values requires the mask to be set
+	//! When RequiresGIL() is false this does not touch any Python object, and can run concurrently on disjoint ranges
+	bool Convert(idx_t current_offset, Vector &input, idx_t source_size, idx_t source_offset, idx_t count);
+	//! Whether converting this type creates Python objects (and therefore needs to hold the GIL)
+	bool RequiresGIL() const;
 	py::object ToArray() const;
+	//! The converted rows as a view of the buffers, which stay owned by this wrapper
+	py::object ToArrayView() const;
+	//! Start over at offset 0, either writing into the current buffers or into newly allocated ones
+	void Reset(idx_t capacity, bool reuse_buffers);
 };
 
 } // namespace duckdb
@@ -11,18 +11,50 @@
 #include "duckdb_python/pybind11/pybind_wrapper.hpp"
 #include "duckdb_python/numpy/array_wrapper.hpp"
 #include "duckdb.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 
 namespace duckdb {
 
 class NumpyResultConversion {
 public:
+	//! Arrays are grown by reallocating them up to this many rows, after that the rows are collected in new segments
+	//! which are concatenated once in ToArray
+	static constexpr const idx_t SEGMENT_CAPACITY = STANDARD_VECTOR_SIZE * 512ULL;
+
+public:
+	//! With 'reuse_buffers' the columns that do not hold Python objects are written into the same buffers after every
+	//! Reset, ToArray then returns views of those buffers
+	//! With 'arrays_2d' the ARRAY columns of fixed-width types are converted to 2-D arrays
+	//! With 'decimal_as_integer' the DECIMAL columns are converted to their unscaled integers
 	NumpyResultConversion(const vector<LogicalType> &types, idx_t initial_capacity,
-	                      const ClientProperties &client_properties, bool pandas = false);
+	                      const ClientProperties &client_properties, bool pandas = false,
+	                      bool categorical_strings = false, bool reuse_buffers = false, bool arrays_2d = false,
+	                      bool decimal_as_integer = false);
 
 	void Append(DataChunk &chunk);
+	//! Append the rows [offset, offset + to_append) of the chunk
+	//! The columns that do not create Python objects are converted with the GIL released
+	void Append(DataChunk &chunk, idx_t offset, idx_t to_append);
+	//! Start a new batch of at most 'capacity' rows, the arrays returned by ToArray before stay valid unless the
+	//! buffers are reused
+	void Reset();
+	//! Append all the rows of a (materialized) collection
+	//! The columns that do not create Python objects are converted in parallel with the GIL released, the remaining
+	//! columns are converted afterwards on the calling thread
+	void Append(ColumnDataCollection &collection, ClientContext &context);
 
-	py::object ToArray(idx_t col_idx) {
-		return owned_data[col_idx].ToArray();
+	py::object ToArray(idx_t col_idx);
+	//! Whether the column is a VARCHAR column that is converted to categorical codes
+	bool HasStringCategories(idx_t col_idx) const {
+		return owned_data[col_idx].string_categories != nullptr;
+	}
+	//! The categories the codes of a VARCHAR column refer to, in order of appearance
+	py::list StringCategories(idx_t col_idx) {
+		return owned_data[col_idx].string_categories->categories;
+	}
+	//! Whether the column is a DECIMAL column that is converted to its unscaled integers
+	bool DecimalAsInteger(idx_t col_idx) const {
+		return owned_data[col_idx].decimal_as_integer;
 	}
 	bool ToPandas() const {
 		return pandas;
@@ -30,12 +62,23 @@ public:
 
 private:
 	void Resize(idx_t new_capacity);
+	//! Move the arrays of the current segment to 'segments' and start a new segment
+	void NewSegment();
 
 private:
+	vector<LogicalType> types;
+	const ClientProperties client_properties;
 	vector<ArrayWrapper> owned_data;
+	//! The finished segments of every column, in order
+	vector<vector<py::object>> segments;
+	//! The amount of rows in the current segment
 	idx_t count;
 	idx_t capacity;
 	bool pandas;
+	bool categorical_strings;
+	bool reuse_buffers;
+	bool arrays_2d;
+	bool decimal_as_integer;
 };
 
 } // namespace duckdb
@@ -2,14 +2,27 @@
 
 #include "duckdb_python/pybind11/pybind_wrapper.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
 
 namespace duckdb {
 
 struct PandasColumnBindData;
 
+//! The kernel used to scan an 'object' column, picked at bind time from the type the analyzer detected
+//! Every kernel but GENERIC handles objects of one exact Python type directly, other objects take the generic path
+enum class NumpyObjectScanType : uint8_t { GENERIC, BOOLEAN, BIGINT, DOUBLE, DATE, TIMESTAMP };
+
 struct NumpyScan {
 	static void Scan(PandasColumnBindData &bind_data, idx_t count, idx_t offset, Vector &out);
-	static void ScanObjectColumn(PyObject **col, idx_t stride, idx_t count, idx_t offset, Vector &out);
+	//! Scan the 'sel_count' rows in 'sel' out of the 'count' rows starting at 'offset', 'out' holds only those rows
+	static void ScanSelection(PandasColumnBindData &bind_data, idx_t count, idx_t offset, const SelectionVector &sel,
+	                          idx_t sel_count, Vector &out);
+	static void ScanObjectColumn(PyObject **col, idx_t stride, idx_t count, idx_t offset, Vector &out,
+	                             NumpyObjectScanType scan_type = NumpyObjectScanType::GENERIC,
+	                             optional_ptr<const SelectionVector> sel = nullptr);
+	static NumpyObjectScanType GetObjectScanType(const LogicalType &type);
 };
 
 } // namespace duckdb
@@ -15,16 +15,21 @@ namespace duckdb {
 
 struct RawArrayWrapper {
 
-	explicit RawArrayWrapper(const LogicalType &type);
+	//! With 'array_as_2d' an ARRAY type that supports it is converted to a 2-D array of its child type
+	explicit RawArrayWrapper(const LogicalType &type, bool array_as_2d = false);
 
 	py::array array;
 	data_ptr_t data;
 	LogicalType type;
 	idx_t type_width;
 	idx_t count;
+	//! The amount of elements in every row when this is a 2-D array, 0 otherwise
+	idx_t array_size;
 
 public:
 	static string DuckDBToNumpyDtype(const LogicalType &type);
+	//! Whether the ARRAY type has a fixed-width child that can be stored in the rows of a 2-D array
+	static bool SupportsArray2D(const LogicalType &type);
 	void Initialize(idx_t capacity);
 	void Resize(idx_t new_capacity);
 	void Append(idx_t current_offset, Vector &input, idx_t count);
@@ -2,6 +2,7 @@
 
 #include "duckdb_python/pandas/pandas_column.hpp"
 #include "duckdb_python/pybind11/pybind_wrapper.hpp"
+#include "duckdb/common/typedefs.hpp"
 
 namespace duckdb {
 
@@ -10,11 +11,21 @@ public:
 	PandasNumpyColumn(py::array array_p) : PandasColumn(PandasColumnBackend::NUMPY), array(std::move(array_p)) {
 		D_ASSERT(py::hasattr(array, "strides"));
 		stride = array.attr("strides").attr("__getitem__")(0).cast<idx_t>();
+		data = const_data_ptr_cast(array.data());
 	}
 
 public:
+	//! Whether a vector with values of 'value_size' can point directly into the array
+	//! This requires the values to be contiguous and aligned to their size
+	bool CanZeroCopy(idx_t value_size) const {
+		return stride == value_size && reinterpret_cast<uintptr_t>(data) % value_size == 0;
+	}
+
+public:
+	//! Vectors created by a zero-copy scan point into this array, it is kept alive by the bind data of the scan
 	py::array array;
 	idx_t stride;
+	const_data_ptr_t data;
 };
 
 } // namespace duckdb
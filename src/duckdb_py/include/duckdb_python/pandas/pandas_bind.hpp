@@ -3,6 +3,7 @@
 #include "duckdb_python/pybind11/pybind_wrapper.hpp"
 #include "duckdb_python/pybind11/python_object_container.hpp"
 #include "duckdb_python/numpy/numpy_type.hpp"
+#include "duckdb_python/numpy/numpy_scan.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb_python/pandas/pandas_column.hpp"
 
@@ -22,6 +23,8 @@ struct PandasColumnBindData {
 	unique_ptr<RegisteredArray> mask;
 	//! Only for categorical types
 	string internal_categorical_type;
+	//! Only for object columns with an analyzed type
+	NumpyObjectScanType object_scan_type = NumpyObjectScanType::GENERIC;
 	//! Hold ownership of objects created during scanning
 	PythonObjectContainer object_str_val;
 };
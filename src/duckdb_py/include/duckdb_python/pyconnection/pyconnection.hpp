@@ -314,10 +314,12 @@ public:
 
 	py::list FetchAll();
 
-	py::dict FetchNumpy();
-	PandasDataFrame FetchDF(bool date_as_object);
+	py::dict FetchNumpy(bool arrays_2d = false, const string &decimal_as = "float");
+	PandasDataFrame FetchDF(bool date_as_object, bool categorical_strings = false);
 	PandasDataFrame FetchDFChunk(const idx_t vectors_per_chunk = 1, bool date_as_object = false);
 
+	py::object FetchNumpyBatches(idx_t batch_size, bool reuse_buffers = false);
+
 	duckdb::pyarrow::Table FetchArrow(idx_t rows_per_batch);
 	PolarsDataFrame FetchPolars(idx_t rows_per_batch, bool lazy);
 
@@ -325,7 +327,8 @@ public:
 
 	py::dict FetchTF();
 
-	duckdb::pyarrow::RecordBatchReader FetchRecordBatchReader(const idx_t rows_per_batch);
+	duckdb::pyarrow::RecordBatchReader FetchRecordBatchReader(const idx_t rows_per_batch,
+	                                                          const idx_t prefetch_batches = 0);
 
 	static shared_ptr<DuckDBPyConnection> Connect(const py::object &database, bool read_only, const py::dict &config);
 
@@ -170,7 +170,7 @@ public:
 
 	unique_ptr<DuckDBPyRelation> Distinct();
 
-	PandasDataFrame FetchDF(bool date_as_object);
+	PandasDataFrame FetchDF(bool date_as_object, bool categorical_strings = false);
 
 	Optional<py::tuple> FetchOne();
 
@@ -178,7 +178,7 @@ public:
 
 	py::list FetchMany(idx_t size);
 
-	py::dict FetchNumpy();
+	py::dict FetchNumpy(bool arrays_2d = false, const string &decimal_as = "float");
 
 	py::dict FetchPyTorch();
 
@@ -188,6 +188,8 @@ public:
 
 	PandasDataFrame FetchDFChunk(const idx_t vectors_per_chunk = 1, bool date_as_object = false);
 
+	py::object FetchNumpyBatches(idx_t batch_size, bool reuse_buffers = false);
+
 	duckdb::pyarrow::Table ToArrowTable(idx_t batch_size);
 
 	duckdb::pyarrow::Table ToArrowTableInternal(idx_t batch_size, bool to_polars);
@@ -196,7 +198,7 @@ public:
 
 	py::object ToArrowCapsule(const py::object &requested_schema = py::none());
 
-	duckdb::pyarrow::RecordBatchReader ToRecordBatch(idx_t batch_size);
+	duckdb::pyarrow::RecordBatchReader ToRecordBatch(idx_t batch_size, idx_t prefetch_batches = 0);
 
 	unique_ptr<DuckDBPyRelation> Union(DuckDBPyRelation *other);
 
@@ -258,6 +260,8 @@ public:
 	bool CanBeRegisteredBy(shared_ptr<ClientContext> &context);
 
 	Relation &GetRel();
+	//! The result of executing the relation, or nullptr if it has not been executed (or the result was consumed)
+	const shared_ptr<DuckDBPyResult> &GetResult() const;
 
 	bool ContainsColumnByName(const string &name) const;
 
@@ -29,23 +29,31 @@ public:
 
 	py::list Fetchall();
 
-	py::dict FetchNumpy();
+	//! With 'arrays_2d' the ARRAY columns of fixed-width types are returned as a single (rows, size) array
+	//! 'decimal_as' is either "float", or "int_scaled" to return DECIMAL columns as (unscaled integers, scale) tuples
+	py::dict FetchNumpy(bool arrays_2d = false, const string &decimal_as = "float");
 
 	py::dict FetchNumpyInternal(bool stream = false, idx_t vectors_per_chunk = 1,
 	                            unique_ptr<NumpyResultConversion> conversion = nullptr);
 
-	PandasDataFrame FetchDF(bool date_as_object);
+	PandasDataFrame FetchDF(bool date_as_object, bool categorical_strings = false);
 
 	duckdb::pyarrow::Table FetchArrowTable(idx_t rows_per_batch, bool to_polars);
 
 	PandasDataFrame FetchDFChunk(const idx_t vectors_per_chunk = 1, bool date_as_object = false);
 
+	//! Fetch the next 'batch_size' rows as a dict of NumPy arrays, returns None once the result is exhausted
+	//! With 'reuse_buffers' the arrays of the previous batch are overwritten, except for the object columns
+	py::object FetchNumpyBatch(idx_t batch_size, bool reuse_buffers = false);
+
 	py::dict FetchPyTorch();
 
 	py::dict FetchTF();
 
-	ArrowArrayStream FetchArrowArrayStream(idx_t rows_per_batch = 1000000);
-	duckdb::pyarrow::RecordBatchReader FetchRecordBatchReader(idx_t rows_per_batch = 1000000);
+	//! When 'prefetch_batches' is non-zero, up to that many batches are produced ahead on a background thread
+	ArrowArrayStream FetchArrowArrayStream(idx_t rows_per_batch = 1000000, idx_t prefetch_batches = 0);
+	duckdb::pyarrow::RecordBatchReader FetchRecordBatchReader(idx_t rows_per_batch = 1000000,
+	                                                          idx_t prefetch_batches = 0);
 	py::object FetchArrowCapsule(idx_t rows_per_batch = 1000000);
 
 	static py::list GetDescription(const vector<string> &names, const vector<LogicalType> &types);
@@ -66,10 +74,16 @@ private:
 
 	PandasDataFrame FrameFromNumpy(bool date_as_object, const py::handle &o);
 
-	void ChangeToTZType(PandasDataFrame &df);
+	//! Fetch up to 'max_rows' rows as a list of tuples, converting the result a chunk at a time
+	py::list FetchRows(idx_t max_rows);
 	unique_ptr<DataChunk> FetchNext(QueryResult &result);
 	unique_ptr<DataChunk> FetchNextRaw(QueryResult &result);
-	unique_ptr<NumpyResultConversion> InitializeNumpyConversion(bool pandas = false);
+	//! 'vectors_per_chunk' is the maximum amount of vectors that will be fetched from a stream, if known
+	unique_ptr<NumpyResultConversion> InitializeNumpyConversion(bool pandas = false,
+	                                                            idx_t vectors_per_chunk = DConstants::INVALID_INDEX,
+	                                                            bool categorical_strings = false,
+	                                                            bool arrays_2d = false,
+	                                                            bool decimal_as_integer = false);
 
 private:
 	idx_t chunk_offset = 0;
@@ -81,6 +95,9 @@ private:
 	// Holds the categorical type of Categorical/ENUM types
 	unordered_map<idx_t, py::object> categories_type;
 	bool result_closed = false;
+	//! The conversion of the last FetchNumpyBatch call, kept to reuse its buffers
+	unique_ptr<NumpyResultConversion> batch_conversion;
+	idx_t batch_conversion_size = 0;
 };
 
 } // namespace duckdb
@@ -198,10 +198,48 @@ public:
 	DUCKDB_API static interval_t GetUTCOffset(py::handle &datetime, py::handle &tzone_obj);
 };
 
+struct PythonTimeZone;
+
 struct PythonObject {
 	static void Initialize();
 	static py::object FromStruct(const Value &value, const LogicalType &id, const ClientProperties &client_properties);
 	static py::object FromValue(const Value &value, const LogicalType &id, const ClientProperties &client_properties);
+	//! Direct constructors for the types that would otherwise be created from their string representation
+	static py::object FromHugeint(hugeint_t value);
+	static py::object FromUhugeint(uhugeint_t value);
+	static py::object FromUUID(hugeint_t value);
+	static py::object FromTime(dtime_t value);
+	//! Create an aware datetime in 'time_zone' from a (finite) UTC timestamp
+	//! Returns an empty object when the result can not be represented by a datetime
+	static py::object FromTimestampTZ(timestamp_t value, const PythonTimeZone &time_zone);
+	//! Convert the first 'count' rows of the vector into Python objects, equivalent to FromValue for every row
+	//! Nested types convert each of their children once for all rows, instead of building a Value tree per row
+	static void FromVector(Vector &input, idx_t count, vector<py::object> &result,
+	                       const ClientProperties &client_properties);
+};
+
+//! Creates decimal.Decimal objects straight from the unscaled integers of a DECIMAL type, without creating a Value
+//! The Decimal class is looked up once, a converter is meant to be reused for all the values of a column
+class PythonDecimalConverter {
+public:
+	explicit PythonDecimalConverter(const LogicalType &type);
+
+public:
+	py::object Convert(int16_t value) const {
+		return Convert(static_cast<int64_t>(value));
+	}
+	py::object Convert(int32_t value) const {
+		return Convert(static_cast<int64_t>(value));
+	}
+	py::object Convert(int64_t value) const;
+	py::object Convert(hugeint_t value) const;
+
+private:
+	py::object Create(bool negative, uhugeint_t magnitude) const;
+
+private:
+	py::object decimal_type;
+	uint8_t scale;
 };
 
 template <class T>
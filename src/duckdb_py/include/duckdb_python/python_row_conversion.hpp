@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb_python/python_row_conversion.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb_python/pybind11/pybind_wrapper.hpp"
+#include "duckdb.hpp"
+#include "duckdb/main/client_properties.hpp"
+
+namespace duckdb {
+
+struct PythonRowConversion;
+
+//! Converts the rows of a column of a chunk into the 'column_idx' slot of the (preallocated) row tuples
+typedef void (*python_column_convert_t)(PythonRowConversion &conversion, idx_t column_idx, Vector &input,
+                                        UnifiedVectorFormat &vdata, idx_t offset, idx_t count, PyObject **rows);
+
+//! Converts DataChunks into lists of Python tuples, one column at a time
+//! The conversion routine of every column is selected once up front, the cells are read directly from the
+//! (unified) vector data instead of being materialized as a Value first
+struct PythonRowConversion {
+public:
+	PythonRowConversion(const vector<LogicalType> &types, const ClientProperties &client_properties);
+
+public:
+	//! Convert the rows [offset, offset + count) of the chunk into a list of tuples
+	py::list Convert(DataChunk &chunk, idx_t offset, idx_t count);
+
+public:
+	const vector<LogicalType> &types;
+	const ClientProperties &client_properties;
+
+private:
+	vector<python_column_convert_t> column_converters;
+};
+
+} // namespace duckdb
@@ -395,16 +395,9 @@ Value TransformDictionary(const PyDictionary &dict) {
 	return TransformDictionaryToStruct(dict);
 }
 
-PythonObjectType GetPythonObjectType(py::handle &ele) {
-	auto &import_cache = *DuckDBPyConnection::ImportCache();
-
-	if (ele.is_none()) {
-		return PythonObjectType::None;
-	} else if (ele.is(import_cache.pandas.NaT())) {
-		return PythonObjectType::None;
-	} else if (ele.is(import_cache.pandas.NA())) {
-		return PythonObjectType::None;
-	} else if (py::isinstance<py::bool_>(ele)) {
+//! The classification of everything but the identity-checked singletons, which only depends on the type of 'ele'
+static PythonObjectType GetPythonObjectTypeInternal(py::handle &ele, PythonImportCache &import_cache) {
+	if (py::isinstance<py::bool_>(ele)) {
 		return PythonObjectType::Bool;
 	} else if (py::isinstance<py::int_>(ele)) {
 		return PythonObjectType::Integer;
@@ -449,6 +442,54 @@ PythonObjectType GetPythonObjectType(py::handle &ele) {
 	}
 }
 
+//! The classification of the types that were seen before, keyed on the exact type
+//! The types are kept alive by the cache, so their address can not be reused by another type
+//! Only accessed while holding the GIL
+static unordered_map<PyTypeObject *, PythonObjectType> &GetObjectTypeCache() {
+	static unordered_map<PyTypeObject *, PythonObjectType> object_type_cache;
+	return object_type_cache;
+}
+
+//! Once this many types are cached new types are classified through the isinstance checks every time
+static constexpr const idx_t OBJECT_TYPE_CACHE_CAPACITY = 256;
+
+PythonObjectType GetPythonObjectType(py::handle &ele) {
+	auto &import_cache = *DuckDBPyConnection::ImportCache();
+
+	if (ele.is_none()) {
+		return PythonObjectType::None;
+	} else if (ele.is(import_cache.pandas.NaT())) {
+		return PythonObjectType::None;
+	} else if (ele.is(import_cache.pandas.NA())) {
+		return PythonObjectType::None;
+	}
+
+	// The exact builtin types are by far the most common, identify them without any lookup
+	auto type = Py_TYPE(ele.ptr());
+	if (type == &PyBool_Type) {
+		return PythonObjectType::Bool;
+	} else if (type == &PyLong_Type) {
+		return PythonObjectType::Integer;
+	} else if (type == &PyFloat_Type) {
+		return PythonObjectType::Float;
+	} else if (type == &PyUnicode_Type) {
+		return PythonObjectType::String;
+	}
+
+	auto &object_type_cache = GetObjectTypeCache();
+	auto entry = object_type_cache.find(type);
+	if (entry != object_type_cache.end()) {
+		return entry->second;
+	}
+	auto object_type = GetPythonObjectTypeInternal(ele, import_cache);
+	// 'None' is the result of an identity check (numpy.ma.masked), that does not hold for every object of the type
+	if (object_type != PythonObjectType::None && object_type_cache.size() < OBJECT_TYPE_CACHE_CAPACITY) {
+		Py_INCREF(type);
+		object_type_cache.emplace(type, object_type);
+	}
+	return object_type;
+}
+
 struct PythonValueConversion {
 	static const LogicalType &ConversionTarget(Value &result, const LogicalType &target_type) {
 		return target_type;
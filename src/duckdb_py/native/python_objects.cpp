@@ -373,6 +373,177 @@ void PythonObject::Initialize() {
 	PyDateTime_IMPORT; // NOLINT: Python datetime initialize #2
 }
 
+//! Create a Python int from the two's complement (or unsigned) 128-bit value
+static py::object LongFromBytes(uint64_t lower, uint64_t upper, bool is_signed) {
+	unsigned char bytes[sizeof(uint64_t) * 2];
+	for (idx_t i = 0; i < sizeof(uint64_t); i++) {
+		bytes[i] = static_cast<unsigned char>(lower >> (i * 8));
+		bytes[sizeof(uint64_t) + i] = static_cast<unsigned char>(upper >> (i * 8));
+	}
+	auto result = _PyLong_FromByteArray(bytes, sizeof(bytes), 1, is_signed ? 1 : 0);
+	if (!result) {
+		throw py::error_already_set();
+	}
+	return py::reinterpret_steal<py::object>(result);
+}
+
+py::object PythonObject::FromHugeint(hugeint_t value) {
+	auto max_lower = static_cast<uint64_t>(NumericLimits<int64_t>::Maximum());
+	if ((value.upper == 0 && value.lower <= max_lower) || (value.upper == -1 && value.lower > max_lower)) {
+		// fits in an int64
+		return py::reinterpret_steal<py::object>(PyLong_FromLongLong(static_cast<int64_t>(value.lower)));
+	}
+	return LongFromBytes(value.lower, static_cast<uint64_t>(value.upper), true);
+}
+
+py::object PythonObject::FromUhugeint(uhugeint_t value) {
+	if (value.upper == 0) {
+		return py::reinterpret_steal<py::object>(PyLong_FromUnsignedLongLong(value.lower));
+	}
+	return LongFromBytes(value.lower, value.upper, false);
+}
+
+py::object PythonObject::FromUUID(hugeint_t value) {
+	auto &import_cache = *DuckDBPyConnection::ImportCache();
+	// the top bit of the stored value is flipped, so UUIDs sort the same way as their string representation
+	auto uuid_int = LongFromBytes(value.lower, static_cast<uint64_t>(value.upper) ^ (uint64_t(1) << 63), false);
+
+	// Equivalent to: uuid.UUID(int=uuid_int), without validating the value in UUID.__init__ again
+	// UUID is immutable, like UUID.__init__ we set its slots through object.__setattr__
+	auto uuid_type = import_cache.uuid.UUID();
+	py::tuple no_args;
+	auto result = py::reinterpret_steal<py::object>(
+	    PyBaseObject_Type.tp_new(reinterpret_cast<PyTypeObject *>(uuid_type.ptr()), no_args.ptr(), nullptr));
+	if (!result) {
+		throw py::error_already_set();
+	}
+	if (PyObject_GenericSetAttr(result.ptr(), py::str("int").ptr(), uuid_int.ptr()) != 0) {
+		throw py::error_already_set();
+	}
+	auto is_safe = import_cache.uuid.SafeUUID.unknown();
+	if (PyObject_GenericSetAttr(result.ptr(), py::str("is_safe").ptr(), is_safe.ptr()) != 0) {
+		throw py::error_already_set();
+	}
+	return result;
+}
+
+py::object PythonObject::FromTimestampTZ(timestamp_t value, const PythonTimeZone &time_zone) {
+	if (time_zone.has_fixed_offset) {
+		// the local time is the UTC time shifted by the offset
+		int64_t local_value;
+		if (!TryAddOperator::Operation(value.value, time_zone.utc_offset_micros, local_value)) {
+			return py::object();
+		}
+		value = timestamp_t(local_value);
+	}
+	int32_t year, month, day, hour, min, sec, micros;
+	date_t date;
+	dtime_t time;
+	Timestamp::Convert(value, date, time);
+	Date::Convert(date, year, month, day);
+	Time::Convert(time, hour, min, sec, micros);
+	auto datetime = PyDateTimeAPI->DateTime_FromDateAndTime(year, month, day, hour, min, sec, micros,
+	                                                        time_zone.tzinfo.ptr(), PyDateTimeAPI->DateTimeType);
+	if (!datetime) {
+		PyErr_Clear();
+		return py::object();
+	}
+	auto result = py::reinterpret_steal<py::object>(datetime);
+	if (time_zone.has_fixed_offset) {
+		return result;
+	}
+	// Equivalent to utc_datetime.astimezone(tz), which calls tz.fromutc(utc_datetime.replace(tzinfo=tz))
+	return time_zone.tzinfo.attr("fromutc")(result);
+}
+
+//! Writes the digits of 'value' from least to most significant, returns the amount of digits written
+static idx_t WriteReversedDigits(uint64_t value, char *buffer, idx_t min_digits = 1) {
+	idx_t length = 0;
+	while (value != 0 || length < min_digits) {
+		buffer[length++] = static_cast<char>('0' + value % 10);
+		value /= 10;
+	}
+	return length;
+}
+
+PythonDecimalConverter::PythonDecimalConverter(const LogicalType &type) : scale(DecimalType::GetScale(type)) {
+	auto &import_cache = *DuckDBPyConnection::ImportCache();
+	decimal_type = import_cache.decimal.Decimal();
+}
+
+py::object PythonDecimalConverter::Convert(int64_t value) const {
+	auto negative = value < 0;
+	// negate in the unsigned domain, so the minimum value does not overflow
+	auto magnitude = negative ? ~static_cast<uint64_t>(value) + 1 : static_cast<uint64_t>(value);
+	return Create(negative, uhugeint_t(magnitude));
+}
+
+py::object PythonDecimalConverter::Convert(hugeint_t value) const {
+	auto negative = value < hugeint_t(0);
+	uhugeint_t magnitude;
+	magnitude.lower = value.lower;
+	magnitude.upper = static_cast<uint64_t>(value.upper);
+	if (negative) {
+		magnitude = uhugeint_t(0) - magnitude;
+	}
+	return Create(negative, magnitude);
+}
+
+py::object PythonDecimalConverter::Create(bool negative, uhugeint_t magnitude) const {
+	// The widest DECIMAL has 38 digits, the string looks like "-0.000123" or "-123.45"
+	static constexpr const uint64_t DIGITS_PER_WORD = 18;
+	static constexpr const uint64_t WORD_DIVISOR = 1000000000000000000ULL;
+	char digits[64];
+	idx_t digit_count = 0;
+	while (magnitude.upper != 0) {
+		auto quotient = magnitude / uhugeint_t(WORD_DIVISOR);
+		auto remainder = magnitude - quotient * uhugeint_t(WORD_DIVISOR);
+		digit_count += WriteReversedDigits(remainder.lower, digits + digit_count, DIGITS_PER_WORD);
+		magnitude = quotient;
+	}
+	digit_count += WriteReversedDigits(magnitude.lower, digits + digit_count);
+	// there is always at least one digit in front of the decimal point
+	while (digit_count <= scale) {
+		digits[digit_count++] = '0';
+	}
+
+	char buffer[64];
+	idx_t length = 0;
+	if (negative) {
+		buffer[length++] = '-';
+	}
+	for (idx_t i = digit_count; i > scale; i--) {
+		buffer[length++] = digits[i - 1];
+	}
+	if (scale > 0) {
+		buffer[length++] = '.';
+		for (idx_t i = scale; i > 0; i--) {
+			buffer[length++] = digits[i - 1];
+		}
+	}
+	auto str = py::reinterpret_steal<py::object>(PyUnicode_FromStringAndSize(buffer, static_cast<Py_ssize_t>(length)));
+	if (!str) {
+		throw py::error_already_set();
+	}
+	auto result = PyObject_CallFunctionObjArgs(decimal_type.ptr(), str.ptr(), nullptr);
+	if (!result) {
+		throw py::error_already_set();
+	}
+	return py::reinterpret_steal<py::object>(result);
+}
+
+py::object PythonObject::FromTime(dtime_t value) {
+	int32_t hour, min, sec, microsec;
+	duckdb::Time::Convert(value, hour, min, sec, microsec);
+	auto pytime = PyTime_FromTime(hour, min, sec, microsec);
+	if (!pytime) {
+		// e.g. 24:00:00, which can not be represented by datetime.time
+		PyErr_Clear();
+		return py::str(duckdb::Time::ToString(value));
+	}
+	return py::reinterpret_steal<py::object>(pytime);
+}
+
 enum class InfinityType : uint8_t { NONE, POSITIVE, NEGATIVE };
 
 InfinityType GetTimestampInfinityType(timestamp_t &timestamp) {
@@ -489,15 +660,28 @@ py::object PythonObject::FromValue(const Value &val, const LogicalType &type,
 	case LogicalTypeId::UBIGINT:
 		return py::cast(val.GetValue<uint64_t>());
 	case LogicalTypeId::HUGEINT:
-		return py::reinterpret_steal<py::object>(PyLong_FromString(val.GetValue<string>().c_str(), nullptr, 10));
+		return FromHugeint(val.GetValueUnsafe<hugeint_t>());
 	case LogicalTypeId::UHUGEINT:
-		return py::reinterpret_steal<py::object>(PyLong_FromString(val.GetValue<string>().c_str(), nullptr, 10));
+		return FromUhugeint(val.GetValueUnsafe<uhugeint_t>());
 	case LogicalTypeId::FLOAT:
 		return py::cast(val.GetValue<float>());
 	case LogicalTypeId::DOUBLE:
 		return py::cast(val.GetValue<double>());
 	case LogicalTypeId::DECIMAL: {
-		return import_cache.decimal.Decimal()(val.ToString());
+		auto &decimal_type = val.type();
+		PythonDecimalConverter converter(decimal_type);
+		switch (decimal_type.InternalType()) {
+		case PhysicalType::INT16:
+			return converter.Convert(val.GetValueUnsafe<int16_t>());
+		case PhysicalType::INT32:
+			return converter.Convert(val.GetValueUnsafe<int32_t>());
+		case PhysicalType::INT64:
+			return converter.Convert(val.GetValueUnsafe<int64_t>());
+		case PhysicalType::INT128:
+			return converter.Convert(val.GetValueUnsafe<hugeint_t>());
+		default:
+			throw NotImplementedException("Unimplemented internal type for DECIMAL");
+		}
 	}
 	case LogicalTypeId::ENUM:
 		return py::cast(EnumType::GetValue(val));
@@ -526,6 +710,14 @@ py::object PythonObject::FromValue(const Value &val, const LogicalType &type,
 			return py::reinterpret_borrow<py::object>(import_cache.datetime.datetime.min());
 		}
 
+		if (type.id() == LogicalTypeId::TIMESTAMP_TZ) {
+			auto result = FromTimestampTZ(timestamp, import_cache.GetTimeZone(client_properties.time_zone));
+			if (!result) {
+				// Failed to convert, fall back to str
+				return py::str(val.ToString());
+			}
+			return result;
+		}
 		if (type.id() == LogicalTypeId::TIMESTAMP_MS) {
 			timestamp = Timestamp::FromEpochMs(timestamp.value);
 		} else if (type.id() == LogicalTypeId::TIMESTAMP_NS) {
@@ -551,13 +743,6 @@ py::object PythonObject::FromValue(const Value &val, const LogicalType &type,
 			// Failed to convert, fall back to str
 			return py::str(val.ToString());
 		}
-		if (type.id() == LogicalTypeId::TIMESTAMP_TZ) {
-			// We have to add the timezone info
-			auto tz_utc = import_cache.pytz.timezone()("UTC");
-			auto timestamp_utc = tz_utc.attr("localize")(py_timestamp);
-			auto tz_info = import_cache.pytz.timezone()(client_properties.time_zone);
-			return timestamp_utc.attr("astimezone")(tz_info);
-		}
 		return py_timestamp;
 	}
 	case LogicalTypeId::TIME_TZ: {
@@ -587,18 +772,7 @@ py::object PythonObject::FromValue(const Value &val, const LogicalType &type,
 	}
 	case LogicalTypeId::TIME: {
 		D_ASSERT(type.InternalType() == PhysicalType::INT64);
-		int32_t hour, min, sec, microsec;
-		auto time = val.GetValueUnsafe<dtime_t>();
-		duckdb::Time::Convert(time, hour, min, sec, microsec);
-		try {
-			auto pytime = PyTime_FromTime(hour, min, sec, microsec);
-			if (!pytime) {
-				throw py::error_already_set();
-			}
-			return py::reinterpret_steal<py::object>(pytime);
-		} catch (py::error_already_set &e) {
-			return py::str(val.ToString());
-		}
+		return FromTime(val.GetValueUnsafe<dtime_t>());
 	}
 	case LogicalTypeId::DATE: {
 		D_ASSERT(type.InternalType() == PhysicalType::INT32);
@@ -680,8 +854,7 @@ py::object PythonObject::FromValue(const Value &val, const LogicalType &type,
 		return FromStruct(val, type, client_properties);
 	}
 	case LogicalTypeId::UUID: {
-		auto uuid_value = val.GetValueUnsafe<hugeint_t>();
-		return import_cache.uuid.UUID()(UUID::ToString(uuid_value));
+		return FromUUID(val.GetValueUnsafe<hugeint_t>());
 	}
 	case LogicalTypeId::BIGNUM: {
 		auto bignum_value = val.GetValueUnsafe<bignum_t>();
@@ -699,4 +872,229 @@ py::object PythonObject::FromValue(const Value &val, const LogicalType &type,
 	}
 }
 
+template <class T, class FUNC>
+static void FromFlatVector(Vector &input, idx_t count, vector<py::object> &result, FUNC convert) {
+	auto data = FlatVector::GetData<T>(input);
+	auto &validity = FlatVector::Validity(input);
+	for (idx_t i = 0; i < count; i++) {
+		if (validity.RowIsValid(i)) {
+			result[i] = convert(data[i]);
+		} else {
+			result[i] = py::none();
+		}
+	}
+}
+
+template <class T>
+static void FromIntegerVector(Vector &input, idx_t count, vector<py::object> &result) {
+	FromFlatVector<T>(input, count, result, [](T value) { return py::int_(value); });
+}
+
+void PythonObject::FromVector(Vector &input, idx_t count, vector<py::object> &result,
+                              const ClientProperties &client_properties) {
+	result.resize(count);
+	if (count == 0) {
+		return;
+	}
+	input.Flatten(count);
+	auto &type = input.GetType();
+	auto &validity = FlatVector::Validity(input);
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		FromFlatVector<bool>(input, count, result, [](bool value) { return py::bool_(value); });
+		break;
+	case LogicalTypeId::TINYINT:
+		FromIntegerVector<int8_t>(input, count, result);
+		break;
+	case LogicalTypeId::SMALLINT:
+		FromIntegerVector<int16_t>(input, count, result);
+		break;
+	case LogicalTypeId::INTEGER:
+		FromIntegerVector<int32_t>(input, count, result);
+		break;
+	case LogicalTypeId::BIGINT:
+		FromIntegerVector<int64_t>(input, count, result);
+		break;
+	case LogicalTypeId::UTINYINT:
+		FromIntegerVector<uint8_t>(input, count, result);
+		break;
+	case LogicalTypeId::USMALLINT:
+		FromIntegerVector<uint16_t>(input, count, result);
+		break;
+	case LogicalTypeId::UINTEGER:
+		FromIntegerVector<uint32_t>(input, count, result);
+		break;
+	case LogicalTypeId::UBIGINT:
+		FromIntegerVector<uint64_t>(input, count, result);
+		break;
+	case LogicalTypeId::HUGEINT:
+		FromFlatVector<hugeint_t>(input, count, result, FromHugeint);
+		break;
+	case LogicalTypeId::UHUGEINT:
+		FromFlatVector<uhugeint_t>(input, count, result, FromUhugeint);
+		break;
+	case LogicalTypeId::FLOAT:
+		FromFlatVector<float>(input, count, result, [](float value) { return py::float_(value); });
+		break;
+	case LogicalTypeId::DOUBLE:
+		FromFlatVector<double>(input, count, result, [](double value) { return py::float_(value); });
+		break;
+	case LogicalTypeId::VARCHAR:
+		FromFlatVector<string_t>(input, count, result,
+		                         [](string_t value) { return py::str(value.GetData(), value.GetSize()); });
+		break;
+	case LogicalTypeId::UUID:
+		FromFlatVector<hugeint_t>(input, count, result, FromUUID);
+		break;
+	case LogicalTypeId::DECIMAL: {
+		PythonDecimalConverter converter(type);
+		switch (type.InternalType()) {
+		case PhysicalType::INT16:
+			FromFlatVector<int16_t>(input, count, result, [&](int16_t value) { return converter.Convert(value); });
+			break;
+		case PhysicalType::INT32:
+			FromFlatVector<int32_t>(input, count, result, [&](int32_t value) { return converter.Convert(value); });
+			break;
+		case PhysicalType::INT64:
+			FromFlatVector<int64_t>(input, count, result, [&](int64_t value) { return converter.Convert(value); });
+			break;
+		case PhysicalType::INT128:
+			FromFlatVector<hugeint_t>(input, count, result, [&](hugeint_t value) { return converter.Convert(value); });
+			break;
+		default:
+			throw NotImplementedException("Unimplemented internal type for DECIMAL");
+		}
+		break;
+	}
+	case LogicalTypeId::TIME:
+		FromFlatVector<dtime_t>(input, count, result, FromTime);
+		break;
+	case LogicalTypeId::STRUCT: {
+		auto &entries = StructVector::GetEntries(input);
+		auto &child_types = StructType::GetChildTypes(type);
+		vector<vector<py::object>> children(entries.size());
+		for (idx_t child_idx = 0; child_idx < entries.size(); child_idx++) {
+			FromVector(*entries[child_idx], count, children[child_idx], client_properties);
+		}
+		auto unnamed = StructType::IsUnnamed(type);
+		for (idx_t i = 0; i < count; i++) {
+			if (!validity.RowIsValid(i)) {
+				result[i] = py::none();
+				continue;
+			}
+			if (unnamed) {
+				py::tuple py_tuple(children.size());
+				for (idx_t child_idx = 0; child_idx < children.size(); child_idx++) {
+					py_tuple[child_idx] = std::move(children[child_idx][i]);
+				}
+				result[i] = std::move(py_tuple);
+			} else {
+				py::dict py_struct;
+				for (idx_t child_idx = 0; child_idx < children.size(); child_idx++) {
+					py_struct[child_types[child_idx].first.c_str()] = std::move(children[child_idx][i]);
+				}
+				result[i] = std::move(py_struct);
+			}
+		}
+		break;
+	}
+	case LogicalTypeId::LIST: {
+		auto list_entries = FlatVector::GetData<list_entry_t>(input);
+		vector<py::object> child_values;
+		FromVector(ListVector::GetEntry(input), ListVector::GetListSize(input), child_values, client_properties);
+		for (idx_t i = 0; i < count; i++) {
+			if (!validity.RowIsValid(i)) {
+				result[i] = py::none();
+				continue;
+			}
+			auto &entry = list_entries[i];
+			py::list list(entry.length);
+			for (idx_t j = 0; j < entry.length; j++) {
+				PyList_SET_ITEM(list.ptr(), static_cast<Py_ssize_t>(j), // NOLINT
+				                child_values[entry.offset + j].inc_ref().ptr());
+			}
+			result[i] = std::move(list);
+		}
+		break;
+	}
+	case LogicalTypeId::ARRAY: {
+		auto array_size = ArrayType::GetSize(type);
+		vector<py::object> child_values;
+		FromVector(ArrayVector::GetEntry(input), count * array_size, child_values, client_properties);
+		for (idx_t i = 0; i < count; i++) {
+			if (!validity.RowIsValid(i)) {
+				result[i] = py::none();
+				continue;
+			}
+			py::tuple arr(static_cast<py::ssize_t>(array_size));
+			for (idx_t j = 0; j < array_size; j++) {
+				arr[j] = std::move(child_values[i * array_size + j]);
+			}
+			result[i] = std::move(arr);
+		}
+		break;
+	}
+	case LogicalTypeId::MAP: {
+		auto list_entries = FlatVector::GetData<list_entry_t>(input);
+		auto child_count = ListVector::GetListSize(input);
+		vector<py::object> keys;
+		vector<py::object> values;
+		FromVector(MapVector::GetKeys(input), child_count, keys, client_properties);
+		FromVector(MapVector::GetValues(input), child_count, values, client_properties);
+		auto hashable = KeyIsHashable(MapType::KeyType(type));
+		for (idx_t i = 0; i < count; i++) {
+			if (!validity.RowIsValid(i)) {
+				result[i] = py::none();
+				continue;
+			}
+			auto &entry = list_entries[i];
+			py::dict py_struct;
+			if (hashable) {
+				for (idx_t j = entry.offset; j < entry.offset + entry.length; j++) {
+					py_struct[keys[j]] = values[j];
+				}
+			} else {
+				py::list key_list(entry.length);
+				py::list value_list(entry.length);
+				for (idx_t j = 0; j < entry.length; j++) {
+					key_list[j] = keys[entry.offset + j];
+					value_list[j] = values[entry.offset + j];
+				}
+				py_struct["key"] = std::move(key_list);
+				py_struct["value"] = std::move(value_list);
+			}
+			result[i] = std::move(py_struct);
+		}
+		break;
+	}
+	case LogicalTypeId::UNION: {
+		auto member_count = UnionType::GetMemberCount(type);
+		vector<vector<py::object>> members(member_count);
+		for (idx_t member_idx = 0; member_idx < member_count; member_idx++) {
+			FromVector(UnionVector::GetMember(input, member_idx), count, members[member_idx], client_properties);
+		}
+		auto &tags = UnionVector::GetTags(input);
+		tags.Flatten(count);
+		auto tag_data = FlatVector::GetData<union_tag_t>(tags);
+		for (idx_t i = 0; i < count; i++) {
+			if (!validity.RowIsValid(i)) {
+				result[i] = py::none();
+				continue;
+			}
+			result[i] = std::move(members[tag_data[i]][i]);
+		}
+		break;
+	}
+	default:
+		for (idx_t i = 0; i < count; i++) {
+			if (!validity.RowIsValid(i)) {
+				result[i] = py::none();
+				continue;
+			}
+			result[i] = FromValue(input.GetValue(i), type, client_properties);
+		}
+		break;
+	}
+}
+
 } // namespace duckdb
@@ -0,0 +1,330 @@
+#include "duckdb_python/python_row_conversion.hpp"
+#include "duckdb_python/python_objects.hpp"
+#include "duckdb_python/pyconnection/pyconnection.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+
+#include "datetime.h" // Python datetime initialize #1
+
+namespace duckdb {
+
+namespace duckdb_py_row_convert {
+
+//! The direct converters return nullptr for values they can not represent (e.g. infinite dates),
+//! those cells are converted through the generic Value -> PythonObject path instead
+
+struct BooleanConvert {
+	template <class T>
+	static PyObject *ConvertValue(T val) {
+		return PyBool_FromLong(val);
+	}
+};
+
+struct SignedConvert {
+	template <class T>
+	static PyObject *ConvertValue(T val) {
+		return PyLong_FromLongLong(static_cast<long long>(val));
+	}
+};
+
+struct UnsignedConvert {
+	template <class T>
+	static PyObject *ConvertValue(T val) {
+		return PyLong_FromUnsignedLongLong(static_cast<unsigned long long>(val));
+	}
+};
+
+struct FloatConvert {
+	template <class T>
+	static PyObject *ConvertValue(T val) {
+		return PyFloat_FromDouble(static_cast<double>(val));
+	}
+};
+
+struct HugeintConvert {
+	template <class T>
+	static PyObject *ConvertValue(hugeint_t val) {
+		return PythonObject::FromHugeint(val).release().ptr();
+	}
+};
+
+struct UhugeintConvert {
+	template <class T>
+	static PyObject *ConvertValue(uhugeint_t val) {
+		return PythonObject::FromUhugeint(val).release().ptr();
+	}
+};
+
+struct UUIDConvert {
+	template <class T>
+	static PyObject *ConvertValue(hugeint_t val) {
+		return PythonObject::FromUUID(val).release().ptr();
+	}
+};
+
+struct StringConvert {
+	template <class T>
+	static PyObject *ConvertValue(string_t val) {
+		return PyUnicode_DecodeUTF8(val.GetData(), static_cast<Py_ssize_t>(val.GetSize()), nullptr);
+	}
+};
+
+struct BlobConvert {
+	template <class T>
+	static PyObject *ConvertValue(string_t val) {
+		return PyBytes_FromStringAndSize(val.GetData(), static_cast<Py_ssize_t>(val.GetSize()));
+	}
+};
+
+struct DateConvert {
+	template <class T>
+	static PyObject *ConvertValue(date_t val) {
+		if (!Date::IsFinite(val)) {
+			return nullptr;
+		}
+		int32_t year, month, day;
+		Date::Convert(val, year, month, day);
+		return PyDate_FromDate(year, month, day);
+	}
+};
+
+struct TimeConvert {
+	template <class T>
+	static PyObject *ConvertValue(dtime_t val) {
+		int32_t hour, min, sec, micros;
+		Time::Convert(val, hour, min, sec, micros);
+		return PyTime_FromTime(hour, min, sec, micros);
+	}
+};
+
+template <LogicalTypeId TYPE_ID>
+struct TimestampConvert {
+	template <class T>
+	static PyObject *ConvertValue(timestamp_t val) {
+		if (!Timestamp::IsFinite(val)) {
+			return nullptr;
+		}
+		switch (TYPE_ID) {
+		case LogicalTypeId::TIMESTAMP_MS:
+			val = Timestamp::FromEpochMs(val.value);
+			break;
+		case LogicalTypeId::TIMESTAMP_NS:
+			val = Timestamp::FromEpochNanoSeconds(val.value);
+			break;
+		case LogicalTypeId::TIMESTAMP_SEC:
+			val = Timestamp::FromEpochSeconds(val.value);
+			break;
+		default:
+			break;
+		}
+		int32_t year, month, day, hour, min, sec, micros;
+		date_t date;
+		dtime_t time;
+		Timestamp::Convert(val, date, time);
+		Date::Convert(date, year, month, day);
+		Time::Convert(time, hour, min, sec, micros);
+		return PyDateTime_FromDateAndTime(year, month, day, hour, min, sec, micros);
+	}
+};
+
+} // namespace duckdb_py_row_convert
+
+static PyObject *ConvertCellGeneric(PythonRowConversion &conversion, idx_t column_idx, Vector &input, idx_t row) {
+	auto value = input.GetValue(row);
+	return PythonObject::FromValue(value, conversion.types[column_idx], conversion.client_properties).release().ptr();
+}
+
+static PyObject *NoneObject() {
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+template <class T, class OP>
+static void ConvertColumn(PythonRowConversion &conversion, idx_t column_idx, Vector &input,
+                          UnifiedVectorFormat &vdata, idx_t offset, idx_t count, PyObject **rows) {
+	auto src_ptr = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto row = offset + i;
+		auto src_idx = vdata.sel->get_index(row);
+		PyObject *item;
+		if (!vdata.validity.RowIsValid(src_idx)) {
+			item = NoneObject();
+		} else {
+			item = OP::template ConvertValue<T>(src_ptr[src_idx]);
+			if (!item) {
+				PyErr_Clear();
+				item = ConvertCellGeneric(conversion, column_idx, input, row);
+			}
+		}
+		PyTuple_SET_ITEM(rows[i], static_cast<Py_ssize_t>(column_idx), item); // NOLINT
+	}
+}
+
+static void ConvertColumnGeneric(PythonRowConversion &conversion, idx_t column_idx, Vector &input,
+                                 UnifiedVectorFormat &vdata, idx_t offset, idx_t count, PyObject **rows) {
+	for (idx_t i = 0; i < count; i++) {
+		auto row = offset + i;
+		auto src_idx = vdata.sel->get_index(row);
+		PyObject *item;
+		if (!vdata.validity.RowIsValid(src_idx)) {
+			item = NoneObject();
+		} else {
+			item = ConvertCellGeneric(conversion, column_idx, input, row);
+		}
+		PyTuple_SET_ITEM(rows[i], static_cast<Py_ssize_t>(column_idx), item); // NOLINT
+	}
+}
+
+template <class T>
+static void ConvertDecimalColumn(PythonRowConversion &conversion, idx_t column_idx, Vector &input,
+                                 UnifiedVectorFormat &vdata, idx_t offset, idx_t count, PyObject **rows) {
+	// the Decimal class is looked up once for the whole column
+	PythonDecimalConverter converter(input.GetType());
+	auto src_ptr = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto src_idx = vdata.sel->get_index(offset + i);
+		PyObject *item;
+		if (!vdata.validity.RowIsValid(src_idx)) {
+			item = NoneObject();
+		} else {
+			item = converter.Convert(src_ptr[src_idx]).release().ptr();
+		}
+		PyTuple_SET_ITEM(rows[i], static_cast<Py_ssize_t>(column_idx), item); // NOLINT
+	}
+}
+
+static void ConvertTimestampTZColumn(PythonRowConversion &conversion, idx_t column_idx, Vector &input,
+                                     UnifiedVectorFormat &vdata, idx_t offset, idx_t count, PyObject **rows) {
+	// the time zone is looked up once for the whole column
+	auto &import_cache = *DuckDBPyConnection::ImportCache();
+	auto &time_zone = import_cache.GetTimeZone(conversion.client_properties.time_zone);
+	auto src_ptr = UnifiedVectorFormat::GetData<timestamp_t>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto row = offset + i;
+		auto src_idx = vdata.sel->get_index(row);
+		PyObject *item;
+		if (!vdata.validity.RowIsValid(src_idx)) {
+			item = NoneObject();
+		} else {
+			item = nullptr;
+			if (Timestamp::IsFinite(src_ptr[src_idx])) {
+				item = PythonObject::FromTimestampTZ(src_ptr[src_idx], time_zone).release().ptr();
+			}
+			if (!item) {
+				item = ConvertCellGeneric(conversion, column_idx, input, row);
+			}
+		}
+		PyTuple_SET_ITEM(rows[i], static_cast<Py_ssize_t>(column_idx), item); // NOLINT
+	}
+}
+
+static python_column_convert_t GetDecimalColumnConverter(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT16:
+		return ConvertDecimalColumn<int16_t>;
+	case PhysicalType::INT32:
+		return ConvertDecimalColumn<int32_t>;
+	case PhysicalType::INT64:
+		return ConvertDecimalColumn<int64_t>;
+	case PhysicalType::INT128:
+		return ConvertDecimalColumn<hugeint_t>;
+	default:
+		return ConvertColumnGeneric;
+	}
+}
+
+static python_column_convert_t GetColumnConverter(const LogicalType &type) {
+	using namespace duckdb_py_row_convert; // NOLINT
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		return ConvertColumn<bool, BooleanConvert>;
+	case LogicalTypeId::TINYINT:
+		return ConvertColumn<int8_t, SignedConvert>;
+	case LogicalTypeId::SMALLINT:
+		return ConvertColumn<int16_t, SignedConvert>;
+	case LogicalTypeId::INTEGER:
+		return ConvertColumn<int32_t, SignedConvert>;
+	case LogicalTypeId::BIGINT:
+		return ConvertColumn<int64_t, SignedConvert>;
+	case LogicalTypeId::UTINYINT:
+		return ConvertColumn<uint8_t, UnsignedConvert>;
+	case LogicalTypeId::USMALLINT:
+		return ConvertColumn<uint16_t, UnsignedConvert>;
+	case LogicalTypeId::UINTEGER:
+		return ConvertColumn<uint32_t, UnsignedConvert>;
+	case LogicalTypeId::UBIGINT:
+		return ConvertColumn<uint64_t, UnsignedConvert>;
+	case LogicalTypeId::HUGEINT:
+		return ConvertColumn<hugeint_t, HugeintConvert>;
+	case LogicalTypeId::UHUGEINT:
+		return ConvertColumn<uhugeint_t, UhugeintConvert>;
+	case LogicalTypeId::UUID:
+		return ConvertColumn<hugeint_t, UUIDConvert>;
+	case LogicalTypeId::FLOAT:
+		return ConvertColumn<float, FloatConvert>;
+	case LogicalTypeId::DOUBLE:
+		return ConvertColumn<double, FloatConvert>;
+	case LogicalTypeId::DECIMAL:
+		return GetDecimalColumnConverter(type);
+	case LogicalTypeId::VARCHAR:
+		return ConvertColumn<string_t, StringConvert>;
+	case LogicalTypeId::BLOB:
+		return ConvertColumn<string_t, BlobConvert>;
+	case LogicalTypeId::DATE:
+		return ConvertColumn<date_t, DateConvert>;
+	case LogicalTypeId::TIME:
+		return ConvertColumn<dtime_t, TimeConvert>;
+	case LogicalTypeId::TIMESTAMP:
+		return ConvertColumn<timestamp_t, TimestampConvert<LogicalTypeId::TIMESTAMP>>;
+	case LogicalTypeId::TIMESTAMP_MS:
+		return ConvertColumn<timestamp_t, TimestampConvert<LogicalTypeId::TIMESTAMP_MS>>;
+	case LogicalTypeId::TIMESTAMP_NS:
+		return ConvertColumn<timestamp_t, TimestampConvert<LogicalTypeId::TIMESTAMP_NS>>;
+	case LogicalTypeId::TIMESTAMP_SEC:
+		return ConvertColumn<timestamp_t, TimestampConvert<LogicalTypeId::TIMESTAMP_SEC>>;
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return ConvertTimestampTZColumn;
+	default:
+		return ConvertColumnGeneric;
+	}
+}
+
+PythonRowConversion::PythonRowConversion(const vector<LogicalType> &types, const ClientProperties &client_properties)
+    : types(types), client_properties(client_properties) {
+	// The datetime C-API is resolved per translation unit
+	if (!PyDateTimeAPI) {
+		PyDateTime_IMPORT; // NOLINT: Python datetime initialize #2
+	}
+	column_converters.reserve(types.size());
+	for (auto &type : types) {
+		column_converters.push_back(GetColumnConverter(type));
+	}
+}
+
+py::list PythonRowConversion::Convert(DataChunk &chunk, idx_t offset, idx_t count) {
+	D_ASSERT(py::gil_check());
+	D_ASSERT(offset + count <= chunk.size());
+	auto column_count = types.size();
+
+	// Preallocate the tuples, every column then fills in its own slot of each row
+	py::list result(count);
+	vector<PyObject *> rows(count);
+	for (idx_t i = 0; i < count; i++) {
+		auto row = PyTuple_New(static_cast<Py_ssize_t>(column_count));
+		if (!row) {
+			throw py::error_already_set();
+		}
+		PyList_SET_ITEM(result.ptr(), static_cast<Py_ssize_t>(i), row); // NOLINT
+		rows[i] = row;
+	}
+	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+		auto &input = chunk.data[col_idx];
+		UnifiedVectorFormat vdata;
+		input.ToUnifiedFormat(chunk.size(), vdata);
+		column_converters[col_idx](*this, col_idx, input, vdata, offset, count, rows.data());
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -10,6 +10,7 @@
 #include "duckdb_python/pyconnection/pyconnection.hpp"
 #include "duckdb_python/pyresult.hpp"
 #include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 
 namespace duckdb {
 
@@ -94,6 +95,25 @@ struct TimestampConvertNano {
 	}
 };
 
+struct TimestampTZConvert {
+	template <class DUCKDB_T, class NUMPY_T>
+	static int64_t ConvertValue(timestamp_t val, NumpyAppendData &append_data) {
+		(void)append_data;
+		return val.value;
+	}
+
+	template <class NUMPY_T, bool PANDAS>
+	static NUMPY_T NullValue(bool &set_mask) {
+		if (PANDAS) {
+			// the timezone-aware column is created from the buffer as is, NULL values are written as NaT
+			set_mask = false;
+			return NumericLimits<int64_t>::Minimum();
+		}
+		set_mask = true;
+		return 0;
+	}
+};
+
 struct DateConvert {
 	template <class DUCKDB_T, class NUMPY_T>
 	static int64_t ConvertValue(date_t val, NumpyAppendData &append_data) {
@@ -125,12 +145,10 @@ struct IntervalConvert {
 struct TimeConvert {
 	template <class DUCKDB_T, class NUMPY_T>
 	static PyObject *ConvertValue(dtime_t val, NumpyAppendData &append_data) {
-		auto &client_properties = append_data.client_properties;
-		auto value = Value::TIME(val);
-		auto py_obj = PythonObject::FromValue(value, LogicalType::TIME, client_properties);
+		(void)append_data;
 		// Release ownership of the PyObject* without decreasing refcount
 		// this returns a handle, of which we take the ptr to get the PyObject*
-		return py_obj.release().ptr();
+		return PythonObject::FromTime(val).release().ptr();
 	}
 
 	template <class NUMPY_T, bool PANDAS>
@@ -187,13 +205,11 @@ struct BitConvert {
 	}
 };
 
-struct UUIDConvert {
+struct HugeintObjectConvert {
 	template <class DUCKDB_T, class NUMPY_T>
 	static PyObject *ConvertValue(hugeint_t val, NumpyAppendData &append_data) {
 		(void)append_data;
-		auto &import_cache = *DuckDBPyConnection::ImportCache();
-		py::handle h = import_cache.uuid.UUID()(UUID::ToString(val)).release();
-		return h.ptr();
+		return PythonObject::FromHugeint(val).release().ptr();
 	}
 
 	template <class NUMPY_T, bool PANDAS>
@@ -203,92 +219,17 @@ struct UUIDConvert {
 	}
 };
 
-static py::object InternalCreateList(Vector &input, idx_t total_size, idx_t offset, idx_t size,
-                                     NumpyAppendData &append_data) {
-	// Initialize the array we'll append the list data to
-	auto &type = input.GetType();
-	ArrayWrapper result(type, append_data.client_properties, append_data.pandas);
-	result.Initialize(size);
-
-	D_ASSERT(offset + size <= total_size);
-	result.Append(0, input, total_size, offset, size);
-	return result.ToArray();
-}
-
-struct ListConvert {
-	static py::object ConvertValue(Vector &input, idx_t chunk_offset, NumpyAppendData &append_data) {
-		auto &client_properties = append_data.client_properties;
-		auto &list_data = append_data.idata;
-
-		// Get the list entry information from the parent
-		const auto list_sel = *list_data.sel;
-		const auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
-		auto list_index = list_sel.get_index(chunk_offset);
-		auto list_entry = list_entries[list_index];
-
-		auto list_size = list_entry.length;
-		auto list_offset = list_entry.offset;
-		auto child_size = ListVector::GetListSize(input);
-		auto &child_vector = ListVector::GetEntry(input);
-
-		return InternalCreateList(child_vector, child_size, list_offset, list_size, append_data);
-	}
-};
-
-struct ArrayConvert {
-	static py::object ConvertValue(Vector &input, idx_t chunk_offset, NumpyAppendData &append_data) {
-		auto &array_data = append_data.idata;
-
-		// Get the list entry information from the parent
-		const auto array_sel = *array_data.sel;
-		auto array_index = array_sel.get_index(chunk_offset);
-
-		auto &array_type = input.GetType();
-		D_ASSERT(array_type.id() == LogicalTypeId::ARRAY);
-
-		auto array_size = ArrayType::GetSize(array_type);
-		auto array_offset = array_index * array_size;
-		auto child_size = ArrayVector::GetTotalSize(input);
-		auto &child_vector = ArrayVector::GetEntry(input);
-
-		return InternalCreateList(child_vector, child_size, array_offset, array_size, append_data);
-	}
-};
-
-struct StructConvert {
-	static py::dict ConvertValue(Vector &input, idx_t chunk_offset, NumpyAppendData &append_data) {
-		auto &client_properties = append_data.client_properties;
-
-		py::dict py_struct;
-		auto val = input.GetValue(chunk_offset);
-		auto &child_types = StructType::GetChildTypes(input.GetType());
-		auto &struct_children = StructValue::GetChildren(val);
-
-		for (idx_t i = 0; i < struct_children.size(); i++) {
-			auto &child_entry = child_types[i];
-			auto &child_name = child_entry.first;
-			auto &child_type = child_entry.second;
-			py_struct[child_name.c_str()] = PythonObject::FromValue(struct_children[i], child_type, client_properties);
-		}
-		return py_struct;
-	}
-};
-
-struct UnionConvert {
-	static py::object ConvertValue(Vector &input, idx_t chunk_offset, NumpyAppendData &append_data) {
-		auto &client_properties = append_data.client_properties;
-		auto val = input.GetValue(chunk_offset);
-		auto value = UnionValue::GetValue(val);
-
-		return PythonObject::FromValue(value, UnionValue::GetType(val), client_properties);
+struct UUIDConvert {
+	template <class DUCKDB_T, class NUMPY_T>
+	static PyObject *ConvertValue(hugeint_t val, NumpyAppendData &append_data) {
+		(void)append_data;
+		return PythonObject::FromUUID(val).release().ptr();
 	}
-};
 
-struct MapConvert {
-	static py::dict ConvertValue(Vector &input, idx_t chunk_offset, NumpyAppendData &append_data) {
-		auto &client_properties = append_data.client_properties;
-		auto val = input.GetValue(chunk_offset);
-		return PythonObject::FromValue(val, input.GetType(), client_properties);
+	template <class NUMPY_T, bool PANDAS>
+	static NUMPY_T NullValue(bool &set_mask) {
+		set_mask = true;
+		return nullptr;
 	}
 };
 
@@ -409,45 +350,228 @@ static bool ConvertColumnCategoricalTemplate(NumpyAppendData &append_data) {
 	return false;
 }
 
-template <class NUMPY_T, class CONVERT>
-static bool ConvertNested(NumpyAppendData &append_data) {
+//! LIST and ARRAY columns convert the children of all rows into a single array once,
+//! every row then becomes a slice view of that array
+static bool ConvertListColumn(NumpyAppendData &append_data) {
 	auto target_offset = append_data.target_offset;
-	auto target_data = append_data.target_data;
 	auto target_mask = append_data.target_mask;
 	auto &input = append_data.input;
 	auto &idata = append_data.idata;
-	auto &client_properties = append_data.client_properties;
 	auto count = append_data.count;
 	auto source_offset = append_data.source_offset;
 
-	auto out_ptr = reinterpret_cast<NUMPY_T *>(target_data);
-	if (!idata.validity.AllValid()) {
-		bool requires_mask = false;
+	auto &type = input.GetType();
+	auto is_array = type.id() == LogicalTypeId::ARRAY;
+	auto array_size = is_array ? ArrayType::GetSize(type) : 0;
+	auto list_entries = is_array ? nullptr : UnifiedVectorFormat::GetData<list_entry_t>(idata);
+	auto get_entry = [&](idx_t src_idx) {
+		return is_array ? list_entry_t(src_idx * array_size, array_size) : list_entries[src_idx];
+	};
+
+	// Find the range of the child vector that is referenced by the rows we convert
+	idx_t child_start = NumericLimits<idx_t>::Maximum();
+	idx_t child_end = 0;
+	for (idx_t i = 0; i < count; i++) {
+		idx_t src_idx = idata.sel->get_index(i + source_offset);
+		if (!idata.validity.RowIsValid(src_idx)) {
+			continue;
+		}
+		auto entry = get_entry(src_idx);
+		child_start = MinValue<idx_t>(child_start, entry.offset);
+		child_end = MaxValue<idx_t>(child_end, entry.offset + entry.length);
+	}
+	if (child_start > child_end) {
+		child_start = child_end = 0;
+	}
+
+	auto &child_vector = is_array ? ArrayVector::GetEntry(input) : ListVector::GetEntry(input);
+	auto child_size = is_array ? ArrayVector::GetTotalSize(input) : ListVector::GetListSize(input);
+	ArrayWrapper child(child_vector.GetType(), append_data.client_properties, append_data.pandas);
+	child.Initialize(child_end - child_start);
+	child.Append(0, child_vector, child_size, child_start, child_end - child_start);
+
+	// Rows without NULL children are slices of the plain values, like the per-row arrays used to be
+	auto child_mask = reinterpret_cast<bool *>(child.mask->data);
+	vector<bool> row_has_null(count, false);
+	if (child.requires_mask) {
 		for (idx_t i = 0; i < count; i++) {
-			idx_t index = i + source_offset;
-			idx_t src_idx = idata.sel->get_index(index);
-			idx_t offset = target_offset + i;
-			if (!idata.validity.RowIsValidUnsafe(src_idx)) {
-				out_ptr[offset] = py::none();
+			idx_t src_idx = idata.sel->get_index(i + source_offset);
+			if (!idata.validity.RowIsValid(src_idx)) {
+				continue;
+			}
+			auto entry = get_entry(src_idx);
+			for (idx_t child_idx = entry.offset; child_idx < entry.offset + entry.length; child_idx++) {
+				if (child_mask[child_idx - child_start]) {
+					row_has_null[i] = true;
+					break;
+				}
+			}
+		}
+	}
+	auto masked_values = child.ToArray();
+	py::object values = child.requires_mask ? py::object(masked_values.attr("data")) : masked_values;
+
+	auto out_ptr = reinterpret_cast<py::object *>(append_data.target_data);
+	bool requires_mask = false;
+	for (idx_t i = 0; i < count; i++) {
+		idx_t src_idx = idata.sel->get_index(i + source_offset);
+		idx_t offset = target_offset + i;
+		if (!idata.validity.RowIsValid(src_idx)) {
+			out_ptr[offset] = py::none();
+			requires_mask = true;
+			target_mask[offset] = true;
+			continue;
+		}
+		auto entry = get_entry(src_idx);
+		auto &source = row_has_null[i] ? masked_values : values;
+		auto slice = PySequence_GetSlice(source.ptr(), static_cast<Py_ssize_t>(entry.offset - child_start),
+		                                 static_cast<Py_ssize_t>(entry.offset - child_start + entry.length));
+		if (!slice) {
+			throw py::error_already_set();
+		}
+		out_ptr[offset] = py::reinterpret_steal<py::object>(slice);
+		target_mask[offset] = false;
+	}
+	return requires_mask;
+}
+
+//! Converts an ARRAY column into the rows of a 2-D array, all elements of a NULL array are masked
+template <class T>
+static bool ConvertArray2DTemplate(NumpyAppendData &append_data) {
+	auto &input = append_data.input;
+	auto &idata = append_data.idata;
+	auto count = append_data.count;
+	auto source_offset = append_data.source_offset;
+	auto array_size = ArrayType::GetSize(input.GetType());
+
+	auto &child_vector = ArrayVector::GetEntry(input);
+	UnifiedVectorFormat child_data;
+	child_vector.ToUnifiedFormat(ArrayVector::GetTotalSize(input), child_data);
+	auto child_ptr = UnifiedVectorFormat::GetData<T>(child_data);
+	auto out_ptr = reinterpret_cast<T *>(append_data.target_data) + append_data.target_offset * array_size;
+	auto mask_ptr = append_data.target_mask + append_data.target_offset * array_size;
+
+	if (input.GetVectorType() == VectorType::FLAT_VECTOR && idata.validity.AllValid() &&
+	    child_vector.GetVectorType() == VectorType::FLAT_VECTOR && child_data.validity.AllValid()) {
+		// the rows are stored back to back in the child vector, which has the same layout as the 2-D array
+		memcpy(out_ptr, child_ptr + source_offset * array_size, count * array_size * sizeof(T));
+		memset(mask_ptr, 0, count * array_size * sizeof(bool));
+		return false;
+	}
+	bool requires_mask = false;
+	for (idx_t i = 0; i < count; i++) {
+		auto src_idx = idata.sel->get_index(i + source_offset);
+		auto row_ptr = out_ptr + i * array_size;
+		auto row_mask = mask_ptr + i * array_size;
+		if (!idata.validity.RowIsValid(src_idx)) {
+			memset(row_ptr, 0, array_size * sizeof(T));
+			memset(row_mask, 1, array_size * sizeof(bool));
+			requires_mask = true;
+			continue;
+		}
+		for (idx_t elem_idx = 0; elem_idx < array_size; elem_idx++) {
+			auto child_idx = child_data.sel->get_index(src_idx * array_size + elem_idx);
+			if (!child_data.validity.RowIsValid(child_idx)) {
+				row_ptr[elem_idx] = 0;
+				row_mask[elem_idx] = true;
 				requires_mask = true;
-				target_mask[offset] = true;
 			} else {
-				out_ptr[offset] = CONVERT::ConvertValue(input, index, append_data);
-				target_mask[offset] = false;
+				row_ptr[elem_idx] = child_ptr[child_idx];
+				row_mask[elem_idx] = false;
 			}
 		}
-		return requires_mask;
-	} else {
+	}
+	return requires_mask;
+}
+
+static bool ConvertArray2D(NumpyAppendData &append_data) {
+	auto &child_type = ArrayType::GetChildType(append_data.input.GetType());
+	switch (child_type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		return ConvertArray2DTemplate<bool>(append_data);
+	case LogicalTypeId::TINYINT:
+		return ConvertArray2DTemplate<int8_t>(append_data);
+	case LogicalTypeId::SMALLINT:
+		return ConvertArray2DTemplate<int16_t>(append_data);
+	case LogicalTypeId::INTEGER:
+		return ConvertArray2DTemplate<int32_t>(append_data);
+	case LogicalTypeId::BIGINT:
+		return ConvertArray2DTemplate<int64_t>(append_data);
+	case LogicalTypeId::UTINYINT:
+		return ConvertArray2DTemplate<uint8_t>(append_data);
+	case LogicalTypeId::USMALLINT:
+		return ConvertArray2DTemplate<uint16_t>(append_data);
+	case LogicalTypeId::UINTEGER:
+		return ConvertArray2DTemplate<uint32_t>(append_data);
+	case LogicalTypeId::UBIGINT:
+		return ConvertArray2DTemplate<uint64_t>(append_data);
+	case LogicalTypeId::FLOAT:
+		return ConvertArray2DTemplate<float>(append_data);
+	case LogicalTypeId::DOUBLE:
+		return ConvertArray2DTemplate<double>(append_data);
+	default:
+		throw InternalException("Unsupported child type \"%s\" for a 2-D array", child_type.ToString());
+	}
+}
+
+//! STRUCT, MAP and UNION columns are converted column-wise: every child vector is converted once for the whole range
+//! instead of materializing a Value for every row
+static bool ConvertNestedColumn(NumpyAppendData &append_data) {
+	auto target_offset = append_data.target_offset;
+	auto target_mask = append_data.target_mask;
+	auto &input = append_data.input;
+	auto &client_properties = append_data.client_properties;
+	auto count = append_data.count;
+	auto source_offset = append_data.source_offset;
+	if (count == 0) {
+		return false;
+	}
+
+	// Copy the range into a flat vector, so the children line up with the rows we convert
+	auto &type = input.GetType();
+	Vector flat(type, count);
+	VectorOperations::Copy(input, flat, source_offset + count, source_offset, 0);
+
+	vector<py::object> values;
+	if (type.id() == LogicalTypeId::STRUCT) {
+		// A top-level STRUCT is always converted to a dict, also when it is unnamed
+		auto &entries = StructVector::GetEntries(flat);
+		auto &child_types = StructType::GetChildTypes(type);
+		vector<vector<py::object>> children(entries.size());
+		for (idx_t child_idx = 0; child_idx < entries.size(); child_idx++) {
+			PythonObject::FromVector(*entries[child_idx], count, children[child_idx], client_properties);
+		}
+		auto &validity = FlatVector::Validity(flat);
+		values.resize(count);
 		for (idx_t i = 0; i < count; i++) {
-			// NOTE: we do not apply the selection vector here,
-			// because we use GetValue inside ConvertValue, which *also* applies the selection vector
-			idx_t index = i + source_offset;
-			idx_t offset = target_offset + i;
-			out_ptr[offset] = CONVERT::ConvertValue(input, index, append_data);
+			if (!validity.RowIsValid(i)) {
+				continue;
+			}
+			py::dict py_struct;
+			for (idx_t child_idx = 0; child_idx < children.size(); child_idx++) {
+				py_struct[child_types[child_idx].first.c_str()] = std::move(children[child_idx][i]);
+			}
+			values[i] = std::move(py_struct);
+		}
+	} else {
+		PythonObject::FromVector(flat, count, values, client_properties);
+	}
+
+	auto out_ptr = reinterpret_cast<py::object *>(append_data.target_data);
+	auto &validity = FlatVector::Validity(flat);
+	bool requires_mask = false;
+	for (idx_t i = 0; i < count; i++) {
+		idx_t offset = target_offset + i;
+		if (!validity.RowIsValid(i)) {
+			out_ptr[offset] = py::none();
+			requires_mask = true;
+			target_mask[offset] = true;
+		} else {
+			out_ptr[offset] = std::move(values[i]);
 			target_mask[offset] = false;
 		}
-		return false;
 	}
+	return requires_mask;
 }
 
 template <class NUMPY_T>
@@ -467,9 +591,151 @@ static bool ConvertColumnCategorical(NumpyAppendData &append_data) {
 
 template <class T>
 static bool ConvertColumnRegular(NumpyAppendData &append_data) {
+	auto &idata = append_data.idata;
+	if (append_data.input.GetVectorType() == VectorType::FLAT_VECTOR && idata.validity.AllValid()) {
+		// the NumPy array has the same layout as the (flat) vector, copy the values in bulk
+		auto src_ptr = UnifiedVectorFormat::GetData<T>(idata);
+		auto out_ptr = reinterpret_cast<T *>(append_data.target_data);
+		memcpy(out_ptr + append_data.target_offset, src_ptr + append_data.source_offset, append_data.count * sizeof(T));
+		memset(append_data.target_mask + append_data.target_offset, 0, append_data.count * sizeof(bool));
+		return false;
+	}
 	return ConvertColumn<T, T, duckdb_py_convert::RegularConvert>(append_data);
 }
 
+PyObject *NumpyStringCache::Convert(string_t val) {
+	if (!enabled) {
+		return PyUnicode_FromStringAndSize(val.GetData(), val.GetSize());
+	}
+	auto entry = entries.find(val);
+	if (entry != entries.end()) {
+		return entry->second.inc_ref().ptr();
+	}
+	auto result = PyUnicode_FromStringAndSize(val.GetData(), val.GetSize());
+	if (!result) {
+		throw py::error_already_set();
+	}
+	if (entries.size() >= MAX_ENTRIES) {
+		// too many distinct strings, stop paying for the lookups
+		enabled = false;
+		entries.clear();
+		heap.Destroy();
+		return result;
+	}
+	entries.emplace(heap.AddBlob(val), py::reinterpret_borrow<py::object>(result));
+	return result;
+}
+
+template <bool PANDAS>
+static bool ConvertStringColumn(NumpyAppendData &append_data, NumpyStringCache &string_cache) {
+	auto target_offset = append_data.target_offset;
+	auto target_data = append_data.target_data;
+	auto target_mask = append_data.target_mask;
+	auto &input = append_data.input;
+	auto &idata = append_data.idata;
+	auto count = append_data.count;
+	auto source_offset = append_data.source_offset;
+
+	auto src_ptr = UnifiedVectorFormat::GetData<string_t>(idata);
+	auto out_ptr = reinterpret_cast<PyObject **>(target_data);
+
+	// dictionary (and constant) vectors reference the same entries many times, convert each entry only once
+	vector<PyObject *> converted_entries;
+	bool reuse_entries = input.GetVectorType() != VectorType::FLAT_VECTOR;
+	if (reuse_entries) {
+		idx_t max_index = 0;
+		for (idx_t i = 0; i < count; i++) {
+			max_index = MaxValue<idx_t>(max_index, idata.sel->get_index(i + source_offset));
+		}
+		converted_entries.resize(max_index + 1, nullptr);
+	}
+
+	bool mask_is_set = false;
+	for (idx_t i = 0; i < count; i++) {
+		idx_t src_idx = idata.sel->get_index(i + source_offset);
+		idx_t offset = target_offset + i;
+		if (!idata.validity.RowIsValid(src_idx)) {
+			out_ptr[offset] =
+			    duckdb_py_convert::StringConvert::template NullValue<PyObject *, PANDAS>(target_mask[offset]);
+			mask_is_set = mask_is_set || target_mask[offset];
+			continue;
+		}
+		if (reuse_entries) {
+			auto &entry = converted_entries[src_idx];
+			if (!entry) {
+				entry = string_cache.Convert(src_ptr[src_idx]);
+			}
+			Py_INCREF(entry);
+			out_ptr[offset] = entry;
+		} else {
+			out_ptr[offset] = string_cache.Convert(src_ptr[src_idx]);
+		}
+		target_mask[offset] = false;
+	}
+	for (auto entry : converted_entries) {
+		Py_XDECREF(entry);
+	}
+	return mask_is_set;
+}
+
+int32_t NumpyStringCategories::GetCode(string_t val) {
+	auto entry = codes.find(val);
+	if (entry != codes.end()) {
+		return entry->second;
+	}
+	if (codes.size() >= static_cast<idx_t>(NumericLimits<int32_t>::Maximum())) {
+		throw InvalidInputException("Too many distinct strings to convert the column to a Categorical");
+	}
+	auto code = static_cast<int32_t>(codes.size());
+	categories.append(py::str(val.GetData(), val.GetSize()));
+	codes.emplace(heap.AddBlob(val), code);
+	return code;
+}
+
+static bool ConvertStringCategories(NumpyAppendData &append_data, NumpyStringCategories &string_categories) {
+	auto target_offset = append_data.target_offset;
+	auto target_data = append_data.target_data;
+	auto &input = append_data.input;
+	auto &idata = append_data.idata;
+	auto count = append_data.count;
+	auto source_offset = append_data.source_offset;
+
+	auto src_ptr = UnifiedVectorFormat::GetData<string_t>(idata);
+	auto out_ptr = reinterpret_cast<int32_t *>(target_data);
+
+	// dictionary (and constant) vectors reference the same entries many times, look up each entry only once
+	vector<int32_t> entry_codes;
+	bool reuse_entries = input.GetVectorType() != VectorType::FLAT_VECTOR;
+	if (reuse_entries) {
+		idx_t max_index = 0;
+		for (idx_t i = 0; i < count; i++) {
+			max_index = MaxValue<idx_t>(max_index, idata.sel->get_index(i + source_offset));
+		}
+		entry_codes.resize(max_index + 1, -1);
+	}
+
+	for (idx_t i = 0; i < count; i++) {
+		idx_t src_idx = idata.sel->get_index(i + source_offset);
+		idx_t offset = target_offset + i;
+		if (!idata.validity.RowIsValid(src_idx)) {
+			// NULL values are encoded as the -1 code
+			out_ptr[offset] = -1;
+			continue;
+		}
+		if (reuse_entries) {
+			auto &code = entry_codes[src_idx];
+			if (code < 0) {
+				code = string_categories.GetCode(src_ptr[src_idx]);
+			}
+			out_ptr[offset] = code;
+		} else {
+			out_ptr[offset] = string_categories.GetCode(src_ptr[src_idx]);
+		}
+	}
+	// Null values are encoded in the data itself
+	return false;
+}
+
 template <class DUCKDB_T>
 static bool ConvertDecimalInternal(NumpyAppendData &append_data, double division) {
 	auto target_offset = append_data.target_offset;
@@ -528,10 +794,59 @@ static bool ConvertDecimal(NumpyAppendData &append_data) {
 	}
 }
 
-ArrayWrapper::ArrayWrapper(const LogicalType &type, const ClientProperties &client_properties_p, bool pandas)
+//! The type of the NumPy array that holds the unscaled integers of a DECIMAL type
+static LogicalType DecimalIntegerType(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT16:
+		return LogicalType::SMALLINT;
+	case PhysicalType::INT32:
+		return LogicalType::INTEGER;
+	case PhysicalType::INT64:
+		return LogicalType::BIGINT;
+	case PhysicalType::INT128:
+		// there is no 128-bit integer dtype, these become Python ints
+		return LogicalType::BIGNUM;
+	default:
+		throw NotImplementedException("Unimplemented internal type for DECIMAL");
+	}
+}
+
+static bool ConvertDecimalInteger(NumpyAppendData &append_data) {
+	switch (append_data.input.GetType().InternalType()) {
+	case PhysicalType::INT16:
+		return ConvertColumnRegular<int16_t>(append_data);
+	case PhysicalType::INT32:
+		return ConvertColumnRegular<int32_t>(append_data);
+	case PhysicalType::INT64:
+		return ConvertColumnRegular<int64_t>(append_data);
+	case PhysicalType::INT128:
+		return ConvertColumn<hugeint_t, PyObject *, duckdb_py_convert::HugeintObjectConvert>(append_data);
+	default:
+		throw NotImplementedException("Unimplemented internal type for DECIMAL");
+	}
+}
+
+ArrayWrapper::ArrayWrapper(const LogicalType &type, const ClientProperties &client_properties_p, bool pandas,
+                           bool categorical_strings, bool arrays_2d, bool decimal_as_integer_p)
     : requires_mask(false), client_properties(client_properties_p), pandas(pandas) {
-	data = make_uniq<RawArrayWrapper>(type);
-	mask = make_uniq<RawArrayWrapper>(LogicalType::BOOLEAN);
+	if (type.id() == LogicalTypeId::VARCHAR && categorical_strings) {
+		data = make_uniq<RawArrayWrapper>(LogicalType::INTEGER);
+		string_categories = make_uniq<NumpyStringCategories>();
+	} else if (type.id() == LogicalTypeId::DECIMAL && decimal_as_integer_p) {
+		data = make_uniq<RawArrayWrapper>(DecimalIntegerType(type));
+		decimal_as_integer = true;
+	} else {
+		data = make_uniq<RawArrayWrapper>(type, arrays_2d);
+	}
+	if (data->array_size) {
+		// every element of the 2-D array has its own mask entry
+		mask = make_uniq<RawArrayWrapper>(LogicalType::ARRAY(LogicalType::BOOLEAN, data->array_size), true);
+	} else {
+		mask = make_uniq<RawArrayWrapper>(LogicalType::BOOLEAN);
+	}
+	if (type.id() == LogicalTypeId::VARCHAR && !categorical_strings) {
+		string_cache = make_uniq<NumpyStringCache>();
+	}
 }
 
 void ArrayWrapper::Initialize(idx_t capacity) {
@@ -544,22 +859,67 @@ void ArrayWrapper::Resize(idx_t new_capacity) {
 	mask->Resize(new_capacity);
 }
 
+bool ArrayWrapper::RequiresGIL() const {
+	if (string_categories) {
+		// the categories are collected as Python objects
+		return true;
+	}
+	if (data->array_size) {
+		return false;
+	}
+	switch (data->type.id()) {
+	case LogicalTypeId::ENUM:
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::INTERVAL:
+		return false;
+	default:
+		return true;
+	}
+}
+
 void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t source_size, idx_t source_offset, idx_t count) {
+	if (count == DConstants::INVALID_INDEX) {
+		D_ASSERT(source_size != DConstants::INVALID_INDEX);
+		count = source_size;
+	}
+	if (Convert(current_offset, input, source_size, source_offset, count)) {
+		requires_mask = true;
+	}
+	data->count += count;
+	mask->count += count;
+}
+
+bool ArrayWrapper::Convert(idx_t current_offset, Vector &input, idx_t source_size, idx_t source_offset,
+                           idx_t count) {
 	auto dataptr = data->data;
 	auto maskptr = reinterpret_cast<bool *>(mask->data);
 	D_ASSERT(dataptr);
 	D_ASSERT(maskptr);
-	D_ASSERT(input.GetType() == data->type);
+	D_ASSERT(input.GetType() == data->type || string_categories || decimal_as_integer);
 	bool may_have_null;
 
 	UnifiedVectorFormat idata;
 	input.ToUnifiedFormat(source_size, idata);
 
-	if (count == DConstants::INVALID_INDEX) {
-		D_ASSERT(source_size != DConstants::INVALID_INDEX);
-		count = source_size;
-	}
-
 	NumpyAppendData append_data(idata, client_properties, input);
 	append_data.target_offset = current_offset;
 	append_data.target_data = dataptr;
@@ -624,15 +984,21 @@ void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t source_size
 		may_have_null = ConvertColumnRegular<double>(append_data);
 		break;
 	case LogicalTypeId::DECIMAL:
-		may_have_null = ConvertDecimal(append_data);
+		if (decimal_as_integer) {
+			may_have_null = ConvertDecimalInteger(append_data);
+		} else {
+			may_have_null = ConvertDecimal(append_data);
+		}
 		break;
 	case LogicalTypeId::TIMESTAMP:
-	case LogicalTypeId::TIMESTAMP_TZ:
 	case LogicalTypeId::TIMESTAMP_SEC:
 	case LogicalTypeId::TIMESTAMP_MS:
 	case LogicalTypeId::TIMESTAMP_NS:
 		may_have_null = ConvertColumn<timestamp_t, int64_t, duckdb_py_convert::TimestampConvertNano>(append_data);
 		break;
+	case LogicalTypeId::TIMESTAMP_TZ:
+		may_have_null = ConvertColumn<timestamp_t, int64_t, duckdb_py_convert::TimestampTZConvert>(append_data);
+		break;
 	case LogicalTypeId::DATE:
 		may_have_null = ConvertColumn<date_t, int64_t, duckdb_py_convert::DateConvert>(append_data);
 		break;
@@ -643,7 +1009,13 @@ void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t source_size
 		may_have_null = ConvertColumn<interval_t, int64_t, duckdb_py_convert::IntervalConvert>(append_data);
 		break;
 	case LogicalTypeId::VARCHAR:
-		may_have_null = ConvertColumn<string_t, PyObject *, duckdb_py_convert::StringConvert>(append_data);
+		if (string_categories) {
+			may_have_null = ConvertStringCategories(append_data, *string_categories);
+		} else if (pandas) {
+			may_have_null = ConvertStringColumn<true>(append_data, *string_cache);
+		} else {
+			may_have_null = ConvertStringColumn<false>(append_data, *string_cache);
+		}
 		break;
 	case LogicalTypeId::BLOB:
 		may_have_null = ConvertColumn<string_t, PyObject *, duckdb_py_convert::BlobConvert>(append_data);
@@ -652,19 +1024,19 @@ void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t source_size
 		may_have_null = ConvertColumn<string_t, PyObject *, duckdb_py_convert::BitConvert>(append_data);
 		break;
 	case LogicalTypeId::LIST:
-		may_have_null = ConvertNested<py::object, duckdb_py_convert::ListConvert>(append_data);
+		may_have_null = ConvertListColumn(append_data);
 		break;
 	case LogicalTypeId::ARRAY:
-		may_have_null = ConvertNested<py::object, duckdb_py_convert::ArrayConvert>(append_data);
+		if (data->array_size) {
+			may_have_null = ConvertArray2D(append_data);
+		} else {
+			may_have_null = ConvertListColumn(append_data);
+		}
 		break;
 	case LogicalTypeId::MAP:
-		may_have_null = ConvertNested<py::object, duckdb_py_convert::MapConvert>(append_data);
-		break;
 	case LogicalTypeId::UNION:
-		may_have_null = ConvertNested<py::object, duckdb_py_convert::UnionConvert>(append_data);
-		break;
 	case LogicalTypeId::STRUCT:
-		may_have_null = ConvertNested<py::object, duckdb_py_convert::StructConvert>(append_data);
+		may_have_null = ConvertNestedColumn(append_data);
 		break;
 	case LogicalTypeId::UUID:
 		may_have_null = ConvertColumn<hugeint_t, PyObject *, duckdb_py_convert::UUIDConvert>(append_data);
@@ -673,11 +1045,7 @@ void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t source_size
 	default:
 		throw NotImplementedException("Unsupported type \"%s\"", input.GetType().ToString());
 	}
-	if (may_have_null) {
-		requires_mask = true;
-	}
-	data->count += count;
-	mask->count += count;
+	return may_have_null;
 }
 
 py::object ArrayWrapper::ToArray() const {
@@ -696,4 +1064,27 @@ py::object ArrayWrapper::ToArray() const {
 	return masked_array;
 }
 
+py::object ArrayWrapper::ToArrayView() const {
+	D_ASSERT(data->array && mask->array);
+	auto rows = py::slice(0, static_cast<py::ssize_t>(data->count), 1);
+	py::object values = data->array[rows];
+	if (!requires_mask) {
+		return values;
+	}
+	py::object nullmask = mask->array[rows];
+	return py::module::import("numpy.ma").attr("masked_array")(values, nullmask);
+}
+
+void ArrayWrapper::Reset(idx_t capacity, bool reuse_buffers) {
+	requires_mask = false;
+	if (reuse_buffers && data->array && mask->array) {
+		data->count = 0;
+		mask->count = 0;
+		return;
+	}
+	data = make_uniq<RawArrayWrapper>(data->type, data->array_size != 0);
+	mask = make_uniq<RawArrayWrapper>(mask->type, mask->array_size != 0);
+	Initialize(capacity);
+}
+
 } // namespace duckdb
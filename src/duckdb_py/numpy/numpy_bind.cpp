@@ -63,6 +63,7 @@ void NumpyBind::Bind(const ClientContext &context, py::handle df, vector<PandasC
 			PandasAnalyzer analyzer(context);
 			if (analyzer.Analyze(get_fun(df_columns[col_idx]))) {
 				duckdb_col_type = analyzer.AnalyzedType();
+				bind_data.object_scan_type = NumpyScan::GetObjectScanType(duckdb_col_type);
 			}
 		}
 
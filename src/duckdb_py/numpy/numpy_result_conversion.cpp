@@ -1,15 +1,24 @@
 #include "duckdb_python/numpy/array_wrapper.hpp"
 #include "duckdb_python/numpy/numpy_result_conversion.hpp"
+#include "duckdb_python/pyconnection/pyconnection.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
 NumpyResultConversion::NumpyResultConversion(const vector<LogicalType> &types, idx_t initial_capacity,
-                                             const ClientProperties &client_properties, bool pandas)
-    : count(0), capacity(0), pandas(pandas) {
+                                             const ClientProperties &client_properties, bool pandas,
+                                             bool categorical_strings, bool reuse_buffers, bool arrays_2d,
+                                             bool decimal_as_integer)
+    : types(types), client_properties(client_properties), count(0), capacity(0), pandas(pandas),
+      categorical_strings(categorical_strings), reuse_buffers(reuse_buffers), arrays_2d(arrays_2d),
+      decimal_as_integer(decimal_as_integer) {
 	owned_data.reserve(types.size());
 	for (auto &type : types) {
-		owned_data.emplace_back(type, client_properties, pandas);
+		owned_data.emplace_back(type, client_properties, pandas, categorical_strings, arrays_2d, decimal_as_integer);
 	}
+	segments.resize(types.size());
 	Resize(initial_capacity);
 }
 
@@ -26,9 +35,33 @@ void NumpyResultConversion::Resize(idx_t new_capacity) {
 	capacity = new_capacity;
 }
 
+void NumpyResultConversion::NewSegment() {
+	for (idx_t col_idx = 0; col_idx < owned_data.size(); col_idx++) {
+		segments[col_idx].push_back(owned_data[col_idx].ToArray());
+	}
+	// the string caches and categories carry over to the new segment
+	vector<ArrayWrapper> new_data;
+	new_data.reserve(types.size());
+	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+		new_data.emplace_back(types[col_idx], client_properties, pandas, categorical_strings, arrays_2d,
+		                      decimal_as_integer);
+		new_data.back().string_cache = std::move(owned_data[col_idx].string_cache);
+		new_data.back().string_categories = std::move(owned_data[col_idx].string_categories);
+	}
+	owned_data = std::move(new_data);
+	count = 0;
+	capacity = 0;
+	Resize(SEGMENT_CAPACITY);
+}
+
 void NumpyResultConversion::Append(DataChunk &chunk) {
 	if (count + chunk.size() > capacity) {
-		Resize(capacity * 2);
+		if (capacity >= SEGMENT_CAPACITY) {
+			// growing the arrays would copy them, start a new segment instead
+			NewSegment();
+		} else {
+			Resize(MaxValue<idx_t>(MinValue<idx_t>(capacity * 2, SEGMENT_CAPACITY), count + chunk.size()));
+		}
 	}
 	auto chunk_types = chunk.GetTypes();
 	auto source_offset = 0;
@@ -46,4 +79,172 @@ void NumpyResultConversion::Append(DataChunk &chunk) {
 #endif
 }
 
+void NumpyResultConversion::Append(DataChunk &chunk, idx_t offset, idx_t to_append) {
+	D_ASSERT(py::gil_check());
+	D_ASSERT(offset + to_append <= chunk.size());
+	if (count + to_append > capacity) {
+		if (capacity >= SEGMENT_CAPACITY) {
+			NewSegment();
+		} else {
+			Resize(MaxValue<idx_t>(MinValue<idx_t>(capacity * 2, SEGMENT_CAPACITY), count + to_append));
+		}
+	}
+	{
+		py::gil_scoped_release release;
+		for (idx_t col_idx = 0; col_idx < owned_data.size(); col_idx++) {
+			if (!owned_data[col_idx].RequiresGIL()) {
+				owned_data[col_idx].Append(count, chunk.data[col_idx], chunk.size(), offset, to_append);
+			}
+		}
+	}
+	for (idx_t col_idx = 0; col_idx < owned_data.size(); col_idx++) {
+		if (owned_data[col_idx].RequiresGIL()) {
+			owned_data[col_idx].Append(count, chunk.data[col_idx], chunk.size(), offset, to_append);
+		}
+	}
+	count += to_append;
+}
+
+void NumpyResultConversion::Reset() {
+	D_ASSERT(py::gil_check());
+	for (idx_t col_idx = 0; col_idx < owned_data.size(); col_idx++) {
+		segments[col_idx].clear();
+		auto &array = owned_data[col_idx];
+		// object arrays are never reused, overwriting them would leak the objects they hold
+		array.Reset(capacity, reuse_buffers && !array.RequiresGIL());
+	}
+	count = 0;
+}
+
+py::object NumpyResultConversion::ToArray(idx_t col_idx) {
+	if (reuse_buffers && segments[col_idx].empty()) {
+		return owned_data[col_idx].ToArrayView();
+	}
+	auto array = owned_data[col_idx].ToArray();
+	auto &column_segments = segments[col_idx];
+	if (column_segments.empty()) {
+		return array;
+	}
+	auto &import_cache = *DuckDBPyConnection::ImportCache();
+	py::list arrays;
+	bool masked = false;
+	for (auto &segment : column_segments) {
+		masked = masked || py::isinstance(segment, import_cache.numpy.ma.masked_array());
+		arrays.append(std::move(segment));
+	}
+	masked = masked || py::isinstance(array, import_cache.numpy.ma.masked_array());
+	arrays.append(std::move(array));
+	column_segments.clear();
+
+	if (masked) {
+		// numpy.ma.concatenate treats the unmasked segments as having no masked values
+		return py::module::import("numpy.ma").attr("concatenate")(arrays);
+	}
+	return py::module::import("numpy").attr("concatenate")(arrays);
+}
+
+//! Converts the chunks of a collection claimed through a shared parallel scan, for the columns that do not need the GIL
+class NumpyConvertColumnsTask : public BaseExecutorTask {
+public:
+	NumpyConvertColumnsTask(TaskExecutor &executor, ColumnDataCollection &collection,
+	                        ColumnDataParallelScanState &scan_state, vector<ArrayWrapper> &owned_data,
+	                        const vector<column_t> &column_ids, idx_t row_offset, vector<bool> &requires_mask)
+	    : BaseExecutorTask(executor), collection(collection), scan_state(scan_state), owned_data(owned_data),
+	      column_ids(column_ids), row_offset(row_offset), requires_mask(requires_mask) {
+		collection.InitializeScanChunk(scan_state.scan_state, chunk);
+	}
+
+	void ExecuteTask() override {
+		ColumnDataLocalScanState local_state;
+		while (collection.Scan(scan_state, local_state, chunk)) {
+			auto target_offset = row_offset + local_state.current_row_index;
+			for (idx_t i = 0; i < column_ids.size(); i++) {
+				auto &array = owned_data[column_ids[i]];
+				if (array.Convert(target_offset, chunk.data[i], chunk.size(), 0, chunk.size())) {
+					requires_mask[i] = true;
+				}
+			}
+		}
+	}
+
+private:
+	ColumnDataCollection &collection;
+	ColumnDataParallelScanState &scan_state;
+	vector<ArrayWrapper> &owned_data;
+	const vector<column_t> &column_ids;
+	idx_t row_offset;
+	vector<bool> &requires_mask;
+	DataChunk chunk;
+};
+
+void NumpyResultConversion::Append(ColumnDataCollection &collection, ClientContext &context) {
+	D_ASSERT(py::gil_check());
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto thread_count = static_cast<idx_t>(scheduler.NumberOfThreads());
+
+	vector<column_t> parallel_columns;
+	vector<column_t> gil_columns;
+	for (idx_t col_idx = 0; col_idx < owned_data.size(); col_idx++) {
+		if (owned_data[col_idx].RequiresGIL()) {
+			gil_columns.push_back(col_idx);
+		} else {
+			parallel_columns.push_back(col_idx);
+		}
+	}
+	if (thread_count <= 1 || collection.ChunkCount() <= 1 || parallel_columns.empty()) {
+		for (auto &chunk : collection.Chunks()) {
+			Append(chunk);
+		}
+		return;
+	}
+
+	auto row_count = collection.Count();
+	if (count + row_count > capacity) {
+		Resize(count + row_count);
+	}
+	auto task_count = MinValue<idx_t>(thread_count, collection.ChunkCount());
+	vector<vector<bool>> task_requires_mask(task_count, vector<bool>(parallel_columns.size(), false));
+	{
+		// these columns never create Python objects, so the GIL can be released while they are converted
+		py::gil_scoped_release release;
+		ColumnDataParallelScanState scan_state;
+		collection.InitializeScan(scan_state, parallel_columns);
+		TaskExecutor executor(context);
+		for (idx_t task_idx = 0; task_idx < task_count; task_idx++) {
+			executor.ScheduleTask(make_uniq<NumpyConvertColumnsTask>(executor, collection, scan_state, owned_data,
+			                                                         parallel_columns, count,
+			                                                         task_requires_mask[task_idx]));
+		}
+		executor.WorkOnTasks();
+	}
+	for (idx_t i = 0; i < parallel_columns.size(); i++) {
+		auto &array = owned_data[parallel_columns[i]];
+		for (auto &requires_mask : task_requires_mask) {
+			if (requires_mask[i]) {
+				array.requires_mask = true;
+			}
+		}
+		array.data->count += row_count;
+		array.mask->count += row_count;
+	}
+
+	if (!gil_columns.empty()) {
+		// the remaining columns are converted on this thread, in order
+		idx_t offset = count;
+		for (auto &chunk : collection.Chunks(gil_columns)) {
+			for (idx_t i = 0; i < gil_columns.size(); i++) {
+				owned_data[gil_columns[i]].Append(offset, chunk.data[i], chunk.size());
+			}
+			offset += chunk.size();
+		}
+	}
+	count += row_count;
+#ifdef DEBUG
+	for (auto &data : owned_data) {
+		D_ASSERT(data.data->count == count);
+		D_ASSERT(data.mask->count == count);
+	}
+#endif
+}
+
 } // namespace duckdb
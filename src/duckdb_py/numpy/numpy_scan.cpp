@@ -17,35 +17,62 @@
 namespace duckdb {
 
 template <class T>
-void ScanNumpyColumn(py::array &numpy_col, idx_t stride, idx_t offset, Vector &out, idx_t count) {
-	auto src_ptr = (T *)numpy_col.data();
-	if (stride == sizeof(T)) {
-		FlatVector::SetData(out, data_ptr_cast(src_ptr + offset));
-	} else {
-		auto tgt_ptr = (T *)FlatVector::GetData(out);
-		for (idx_t i = 0; i < count; i++) {
-			tgt_ptr[i] = src_ptr[stride / sizeof(T) * (i + offset)];
+void ScanNumpyColumn(PandasNumpyColumn &numpy_col, idx_t offset, Vector &out, idx_t count) {
+	if (numpy_col.CanZeroCopy(sizeof(T))) {
+		// The values already have the layout of the vector, point the vector at them
+		FlatVector::SetData(out, const_cast<data_ptr_t>(numpy_col.data + offset * sizeof(T)));
+		return;
+	}
+	// Strided or unaligned values, load them one by one
+	auto tgt_ptr = FlatVector::GetData<T>(out);
+	auto src_ptr = numpy_col.data + offset * numpy_col.stride;
+	for (idx_t i = 0; i < count; i++) {
+		tgt_ptr[i] = Load<T>(src_ptr + i * numpy_col.stride);
+	}
+}
+
+//! Marks the rows for which 'is_null' returns true as invalid, one validity entry (64 rows) at a time
+//! The flags of an entry are combined without branches, which lets the compiler vectorize the inner loop
+template <class IS_NULL>
+static void SetInvalidRows(ValidityMask &validity, idx_t count, IS_NULL &&is_null) {
+	auto entry_count = ValidityMask::EntryCount(count);
+	for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+		auto start = entry_idx * ValidityMask::BITS_PER_VALUE;
+		auto end = MinValue<idx_t>(start + ValidityMask::BITS_PER_VALUE, count);
+		validity_t null_bits = 0;
+		for (idx_t i = start; i < end; i++) {
+			null_bits |= validity_t(is_null(i)) << (i - start);
+		}
+		if (null_bits == 0) {
+			continue;
+		}
+		if (validity.AllValid()) {
+			// Setting the first NULL row allocates the validity buffer
+			auto first_null = start;
+			while (!(null_bits & (validity_t(1) << (first_null - start)))) {
+				first_null++;
+			}
+			validity.SetInvalid(first_null);
 		}
+		validity.GetData()[entry_idx] &= ~null_bits;
 	}
 }
 
+//! Translates the codes of a pandas Categorical to the ENUM indices, a code of -1 is NULL
 template <class T, class V>
-void ScanNumpyCategoryTemplated(py::array &column, idx_t offset, Vector &out, idx_t count) {
-	auto src_ptr = (T *)column.data();
-	auto tgt_ptr = (V *)FlatVector::GetData(out);
-	auto &tgt_mask = FlatVector::Validity(out);
+void ScanNumpyCategoryTemplated(PandasNumpyColumn &column, idx_t offset, Vector &out, idx_t count) {
+	D_ASSERT(column.stride == sizeof(T));
+	auto src_ptr = reinterpret_cast<const T *>(column.data) + offset;
+	auto tgt_ptr = FlatVector::GetData<V>(out);
+	// The -1 codes are copied as well, this keeps the width converting copy free of branches
 	for (idx_t i = 0; i < count; i++) {
-		if (src_ptr[i + offset] == -1) {
-			// Null value
-			tgt_mask.SetInvalid(i);
-		} else {
-			tgt_ptr[i] = src_ptr[i + offset];
-		}
+		tgt_ptr[i] = static_cast<V>(src_ptr[i]);
 	}
+	SetInvalidRows(FlatVector::Validity(out), count, [&](idx_t i) { return src_ptr[i] == -1; });
 }
 
 template <class T>
-void ScanNumpyCategory(py::array &column, idx_t count, idx_t offset, Vector &out, string &src_type) {
+void ScanNumpyCategory(PandasNumpyColumn &column, idx_t count, idx_t offset, Vector &out, string &src_type) {
 	if (src_type == "int8") {
 		ScanNumpyCategoryTemplated<int8_t, T>(column, offset, out, count);
 	} else if (src_type == "int16") {
@@ -61,20 +88,15 @@ void ScanNumpyCategory(py::array &column, idx_t count, idx_t offset, Vector &out
 
 static void ApplyMask(PandasColumnBindData &bind_data, ValidityMask &validity, idx_t count, idx_t offset) {
 	D_ASSERT(bind_data.mask);
-	auto mask = reinterpret_cast<const bool *>(bind_data.mask->numpy_array.data());
-	for (idx_t i = 0; i < count; i++) {
-		auto is_null = mask[offset + i];
-		if (is_null) {
-			validity.SetInvalid(i);
-		}
-	}
+	auto mask = reinterpret_cast<const bool *>(bind_data.mask->numpy_array.data()) + offset;
+	SetInvalidRows(validity, count, [&](idx_t i) { return mask[i]; });
 }
 
 template <class T>
 void ScanNumpyMasked(PandasColumnBindData &bind_data, idx_t count, idx_t offset, Vector &out) {
 	D_ASSERT(bind_data.pandas_col->Backend() == PandasColumnBackend::NUMPY);
 	auto &numpy_col = reinterpret_cast<PandasNumpyColumn &>(*bind_data.pandas_col);
-	ScanNumpyColumn<T>(numpy_col.array, numpy_col.stride, offset, out, count);
+	ScanNumpyColumn<T>(numpy_col, offset, out, count);
 	if (bind_data.mask) {
 		auto &result_mask = FlatVector::Validity(out);
 		ApplyMask(bind_data, result_mask, count, offset);
@@ -82,31 +104,128 @@ void ScanNumpyMasked(PandasColumnBindData &bind_data, idx_t count, idx_t offset,
 }
 
 template <class T>
-void ScanNumpyFpColumn(PandasColumnBindData &bind_data, const T *src_ptr, idx_t stride, idx_t count, idx_t offset,
-                       Vector &out) {
+void ScanNumpyFpColumn(PandasColumnBindData &bind_data, idx_t count, idx_t offset, Vector &out) {
+	D_ASSERT(bind_data.pandas_col->Backend() == PandasColumnBackend::NUMPY);
+	auto &numpy_col = reinterpret_cast<PandasNumpyColumn &>(*bind_data.pandas_col);
+	ScanNumpyColumn<T>(numpy_col, offset, out, count);
+	// Turn NaN values into NULL
 	auto &mask = FlatVector::Validity(out);
-	if (stride == sizeof(T)) {
-		FlatVector::SetData(out, (data_ptr_t)(src_ptr + offset)); // NOLINT
-		// Turn NaN values into NULL
-		auto tgt_ptr = FlatVector::GetData<T>(out);
-		for (idx_t i = 0; i < count; i++) {
-			if (Value::IsNan<T>(tgt_ptr[i])) {
-				mask.SetInvalid(i);
-			}
+	auto tgt_ptr = FlatVector::GetData<T>(out);
+	SetInvalidRows(mask, count, [&](idx_t i) { return Value::IsNan<T>(tgt_ptr[i]); });
+	if (bind_data.mask) {
+		ApplyMask(bind_data, mask, count, offset);
+	}
+}
+
+//! pandas Not a Time (NaT)
+static bool IsNotATime(int64_t value) {
+	return value <= NumericLimits<int64_t>::Minimum();
+}
+
+//! The datetime64 values that are kept as they are: NaT (which becomes NULL) and the infinite timestamps
+static bool IsSpecialDatetime(int64_t value) {
+	return IsNotATime(value) || !Timestamp::IsFinite(timestamp_t(value));
+}
+
+struct NanosecondsToMicros {
+	static bool OutOfRange(int64_t value) {
+		return false;
+	}
+	static int64_t Operation(int64_t value) {
+		return value / Interval::NANOS_PER_MICRO;
+	}
+	static timestamp_t ConvertOrThrow(int64_t value) {
+		return Timestamp::FromEpochNanoSeconds(value);
+	}
+};
+
+template <int64_t MULTIPLIER>
+struct ScaleToMicros {
+	static bool OutOfRange(int64_t value) {
+		return value > NumericLimits<int64_t>::Maximum() / MULTIPLIER ||
+		       value < NumericLimits<int64_t>::Minimum() / MULTIPLIER;
+	}
+	static int64_t Operation(int64_t value) {
+		// Computed unsigned, out of range values wrap around instead of overflowing (they are rejected afterwards)
+		return static_cast<int64_t>(static_cast<uint64_t>(value) * static_cast<uint64_t>(MULTIPLIER));
+	}
+};
+
+struct MillisecondsToMicros : public ScaleToMicros<Interval::MICROS_PER_MSEC> {
+	static timestamp_t ConvertOrThrow(int64_t value) {
+		return Timestamp::FromEpochMs(value);
+	}
+};
+
+struct SecondsToMicros : public ScaleToMicros<Interval::MICROS_PER_SEC> {
+	static timestamp_t ConvertOrThrow(int64_t value) {
+		return Timestamp::FromEpochSeconds(value);
+	}
+};
+
+//! Scans a datetime64 column whose values are stored as they are, the DuckDB type has the unit of the NumPy type
+static void ScanNumpyDatetimeColumn(PandasNumpyColumn &numpy_col, idx_t count, idx_t offset, Vector &out) {
+	ScanNumpyColumn<int64_t>(numpy_col, offset, out, count);
+	auto tgt_ptr = FlatVector::GetData<int64_t>(out);
+	SetInvalidRows(FlatVector::Validity(out), count, [&](idx_t row) { return IsNotATime(tgt_ptr[row]); });
+}
+
+//! Scans a datetime64 column whose values are converted to microseconds by OP
+//! The loop has no branches so the compiler can vectorize it, out of range values are reported afterwards
+template <class OP>
+static void ScanNumpyDatetimeColumn(PandasNumpyColumn &numpy_col, idx_t count, idx_t offset, Vector &out) {
+	auto src_ptr = numpy_col.data + offset * numpy_col.stride;
+	auto tgt_ptr = FlatVector::GetData<timestamp_t>(out);
+	bool out_of_range = false;
+	if (numpy_col.CanZeroCopy(sizeof(int64_t))) {
+		auto values = reinterpret_cast<const int64_t *>(src_ptr);
+		for (idx_t row = 0; row < count; row++) {
+			auto value = values[row];
+			auto is_special = IsSpecialDatetime(value);
+			out_of_range |= !is_special && OP::OutOfRange(value);
+			tgt_ptr[row] = timestamp_t(is_special ? value : OP::Operation(value));
 		}
 	} else {
-		auto tgt_ptr = FlatVector::GetData<T>(out);
-		for (idx_t i = 0; i < count; i++) {
-			tgt_ptr[i] = src_ptr[stride / sizeof(T) * (i + offset)];
-			if (Value::IsNan<T>(tgt_ptr[i])) {
-				mask.SetInvalid(i);
+		for (idx_t row = 0; row < count; row++) {
+			auto value = Load<int64_t>(src_ptr + row * numpy_col.stride);
+			auto is_special = IsSpecialDatetime(value);
+			out_of_range |= !is_special && OP::OutOfRange(value);
+			tgt_ptr[row] = timestamp_t(is_special ? value : OP::Operation(value));
+		}
+	}
+	if (out_of_range) {
+		// Throw the error of the regular conversion for the first value that is out of range
+		for (idx_t row = 0; row < count; row++) {
+			auto value = Load<int64_t>(src_ptr + row * numpy_col.stride);
+			if (!IsSpecialDatetime(value) && OP::OutOfRange(value)) {
+				OP::ConvertOrThrow(value);
 			}
 		}
+		throw InternalException("Datetime conversion reported a value that is out of range, but none was found");
 	}
-	if (bind_data.mask) {
-		auto &result_mask = FlatVector::Validity(out);
-		ApplyMask(bind_data, result_mask, count, offset);
+	SetInvalidRows(FlatVector::Validity(out), count, [&](idx_t row) {
+		return IsNotATime(Load<int64_t>(src_ptr + row * numpy_col.stride));
+	});
+}
+
+//! Scans a timedelta64[ns] column, the nanoseconds are split up into months, days and microseconds
+static void ScanNumpyTimedeltaColumn(PandasNumpyColumn &numpy_col, idx_t count, idx_t offset, Vector &out) {
+	auto src_ptr = numpy_col.data + offset * numpy_col.stride;
+	auto tgt_ptr = FlatVector::GetData<interval_t>(out);
+	for (idx_t row = 0; row < count; row++) {
+		// NaT is converted as well, this keeps the loop free of branches (the row is set to NULL below)
+		int64_t micro = Load<int64_t>(src_ptr + row * numpy_col.stride) / Interval::NANOS_PER_MICRO;
+		int64_t days = micro / Interval::MICROS_PER_DAY;
+		micro = micro % Interval::MICROS_PER_DAY;
+		int64_t months = days / Interval::DAYS_PER_MONTH;
+		days = days % Interval::DAYS_PER_MONTH;
+		tgt_ptr[row].months = static_cast<int32_t>(months);
+		tgt_ptr[row].days = static_cast<int32_t>(days);
+		tgt_ptr[row].micros = micro;
 	}
+	SetInvalidRows(FlatVector::Validity(out), count, [&](idx_t row) {
+		return IsNotATime(Load<int64_t>(src_ptr + row * numpy_col.stride));
+	});
 }
 
 template <class T>
@@ -178,32 +297,293 @@ void VerifyTypeConstraints(Vector &vec, idx_t count) {
 	}
 }
 
-void NumpyScan::ScanObjectColumn(PyObject **col, idx_t stride, idx_t count, idx_t offset, Vector &out) {
+//! The object scan kernels write objects of their exact Python type straight into the result vector
+//! 'TryConvert' returns false for any other object, which is then converted through 'TransformPythonObject'
+struct BooleanObjectScan {
+	using RESULT_TYPE = bool;
+	explicit BooleanObjectScan(PythonImportCache &import_cache) {
+	}
+	bool TryConvert(PyObject *object, bool &result, ValidityMask &mask, idx_t row) const {
+		if (object == Py_True) {
+			result = true;
+			return true;
+		}
+		if (object == Py_False) {
+			result = false;
+			return true;
+		}
+		return false;
+	}
+};
+
+struct BigintObjectScan {
+	using RESULT_TYPE = int64_t;
+	explicit BigintObjectScan(PythonImportCache &import_cache) {
+	}
+	bool TryConvert(PyObject *object, int64_t &result, ValidityMask &mask, idx_t row) const {
+		if (!PyLong_CheckExact(object)) {
+			return false;
+		}
+		int overflow;
+		auto value = PyLong_AsLongLongAndOverflow(object, &overflow);
+		if (overflow != 0 || (value == -1 && PyErr_Occurred())) {
+			// Let the generic path report the error
+			PyErr_Clear();
+			return false;
+		}
+		result = value;
+		return true;
+	}
+};
+
+struct DoubleObjectScan {
+	using RESULT_TYPE = double;
+	explicit DoubleObjectScan(PythonImportCache &import_cache) {
+	}
+	bool TryConvert(PyObject *object, double &result, ValidityMask &mask, idx_t row) const {
+		if (!PyFloat_CheckExact(object)) {
+			return false;
+		}
+		result = PyFloat_AS_DOUBLE(object);
+		if (std::isnan(result)) {
+			mask.SetInvalid(row);
+		}
+		return true;
+	}
+};
+
+struct DateObjectScan {
+	using RESULT_TYPE = date_t;
+	explicit DateObjectScan(PythonImportCache &import_cache) : date_type(import_cache.datetime.date().ptr()) {
+	}
+	bool TryConvert(PyObject *object, date_t &result, ValidityMask &mask, idx_t row) const {
+		if (reinterpret_cast<PyObject *>(Py_TYPE(object)) != date_type) {
+			return false;
+		}
+		py::handle handle(object);
+		PyDate date(handle);
+		result = date.ToDate();
+		return true;
+	}
+
+	PyObject *date_type;
+};
+
+struct TimestampObjectScan {
+	using RESULT_TYPE = timestamp_t;
+	explicit TimestampObjectScan(PythonImportCache &import_cache)
+	    : datetime_type(import_cache.datetime.datetime().ptr()) {
+	}
+	bool TryConvert(PyObject *object, timestamp_t &result, ValidityMask &mask, idx_t row) const {
+		// pandas.Timestamp (and with it pandas.NaT) is a subclass, it is left to the generic path
+		if (reinterpret_cast<PyObject *>(Py_TYPE(object)) != datetime_type) {
+			return false;
+		}
+		py::handle handle(object);
+		PyDateTime datetime(handle);
+		result = datetime.ToTimestamp();
+		return true;
+	}
+
+	PyObject *datetime_type;
+};
+
+template <class OP>
+static void ScanObjectColumnTemplated(PyObject **col, idx_t stride, idx_t count, idx_t offset, Vector &out,
+                                      const SelectionVector &sel) {
+	OP op(*DuckDBPyConnection::ImportCache());
+	auto tgt_ptr = FlatVector::GetData<typename OP::RESULT_TYPE>(out);
+	auto &mask = FlatVector::Validity(out);
+	auto src_ptr = col + stride / sizeof(PyObject *) * offset;
+	auto step = stride / sizeof(PyObject *);
+	for (idx_t i = 0; i < count; i++) {
+		auto object = src_ptr[step * sel.get_index(i)];
+		if (object == Py_None) {
+			mask.SetInvalid(i);
+			continue;
+		}
+		if (!op.TryConvert(object, tgt_ptr[i], mask, i)) {
+			ScanNumpyObject(object, i, out);
+		}
+	}
+}
+
+NumpyObjectScanType NumpyScan::GetObjectScanType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		return NumpyObjectScanType::BOOLEAN;
+	case LogicalTypeId::BIGINT:
+		return NumpyObjectScanType::BIGINT;
+	case LogicalTypeId::DOUBLE:
+		return NumpyObjectScanType::DOUBLE;
+	case LogicalTypeId::DATE:
+		return NumpyObjectScanType::DATE;
+	case LogicalTypeId::TIMESTAMP:
+		return NumpyObjectScanType::TIMESTAMP;
+	default:
+		return NumpyObjectScanType::GENERIC;
+	}
+}
+
+void NumpyScan::ScanObjectColumn(PyObject **col, idx_t stride, idx_t count, idx_t offset, Vector &out,
+                                 NumpyObjectScanType scan_type, optional_ptr<const SelectionVector> sel_p) {
 	// numpy_col is a sequential list of objects, that make up one "column" (Vector)
 	out.SetVectorType(VectorType::FLAT_VECTOR);
 	PythonGILWrapper gil; // We're creating python objects here, so we need the GIL
+	auto &sel = sel_p ? *sel_p : *FlatVector::IncrementalSelectionVector();
+
+	switch (scan_type) {
+	case NumpyObjectScanType::BOOLEAN:
+		D_ASSERT(out.GetType().id() == LogicalTypeId::BOOLEAN);
+		ScanObjectColumnTemplated<BooleanObjectScan>(col, stride, count, offset, out, sel);
+		return;
+	case NumpyObjectScanType::BIGINT:
+		D_ASSERT(out.GetType().id() == LogicalTypeId::BIGINT);
+		ScanObjectColumnTemplated<BigintObjectScan>(col, stride, count, offset, out, sel);
+		return;
+	case NumpyObjectScanType::DOUBLE:
+		D_ASSERT(out.GetType().id() == LogicalTypeId::DOUBLE);
+		ScanObjectColumnTemplated<DoubleObjectScan>(col, stride, count, offset, out, sel);
+		return;
+	case NumpyObjectScanType::DATE:
+		D_ASSERT(out.GetType().id() == LogicalTypeId::DATE);
+		ScanObjectColumnTemplated<DateObjectScan>(col, stride, count, offset, out, sel);
+		return;
+	case NumpyObjectScanType::TIMESTAMP:
+		D_ASSERT(out.GetType().id() == LogicalTypeId::TIMESTAMP);
+		ScanObjectColumnTemplated<TimestampObjectScan>(col, stride, count, offset, out, sel);
+		return;
+	default:
+		break;
+	}
 
 	if (stride == sizeof(PyObject *)) {
 		auto src_ptr = col + offset;
 		for (idx_t i = 0; i < count; i++) {
-			ScanNumpyObject(src_ptr[i], i, out);
+			ScanNumpyObject(src_ptr[sel.get_index(i)], i, out);
 		}
 	} else {
 		for (idx_t i = 0; i < count; i++) {
-			auto src_ptr = col[stride / sizeof(PyObject *) * (i + offset)];
+			auto src_ptr = col[stride / sizeof(PyObject *) * (sel.get_index(i) + offset)];
 			ScanNumpyObject(src_ptr, i, out);
 		}
 	}
 	VerifyTypeConstraints(out, count);
 }
 
+//! Scans an 'object' or string column, 'sel' (if set) holds the rows relative to 'offset' that are converted
+//! The converted rows are written to the start of 'out', 'count' is the amount of rows in the output
+static void ScanPythonObjectColumn(PandasColumnBindData &bind_data, idx_t count, idx_t offset, Vector &out,
+                                   optional_ptr<const SelectionVector> sel_p) {
+	D_ASSERT(bind_data.pandas_col->Backend() == PandasColumnBackend::NUMPY);
+	auto &numpy_col = reinterpret_cast<PandasNumpyColumn &>(*bind_data.pandas_col);
+	auto &array = numpy_col.array;
+	// Get the source pointer of the numpy array
+	auto src_ptr = (PyObject **)array.data(); // NOLINT
+	const bool is_object_col = bind_data.numpy_type.type == NumpyNullableType::OBJECT;
+	if (is_object_col && out.GetType().id() != LogicalTypeId::VARCHAR) {
+		//! We have determined the underlying logical type of this object column
+		return NumpyScan::ScanObjectColumn(src_ptr, numpy_col.stride, count, offset, out, bind_data.object_scan_type,
+		                                   sel_p);
+	}
+	auto &sel = sel_p ? *sel_p : *FlatVector::IncrementalSelectionVector();
+
+	// Get the data pointer and the validity mask of the result vector
+	auto tgt_ptr = FlatVector::GetData<string_t>(out);
+	auto &out_mask = FlatVector::Validity(out);
+	unique_ptr<PythonGILWrapper> gil;
+	auto &import_cache = *DuckDBPyConnection::ImportCache();
+
+	// Loop over every row of the arrays contents
+	auto stride = numpy_col.stride;
+	for (idx_t row = 0; row < count; row++) {
+		auto source_idx = stride / sizeof(PyObject *) * (sel.get_index(row) + offset);
+
+		// Get the pointer to the object
+		PyObject *val = src_ptr[source_idx];
+		if (!py::isinstance<py::str>(val)) {
+			if (val == Py_None) {
+				out_mask.SetInvalid(row);
+				continue;
+			}
+			if (import_cache.pandas.NaT(false)) {
+				// If pandas is imported, check if this is pandas.NaT
+				py::handle value(val);
+				if (value.is(import_cache.pandas.NaT())) {
+					out_mask.SetInvalid(row);
+					continue;
+				}
+			}
+			if (import_cache.pandas.NA(false)) {
+				// If pandas is imported, check if this is pandas.NA
+				py::handle value(val);
+				if (value.is(import_cache.pandas.NA())) {
+					out_mask.SetInvalid(row);
+					continue;
+				}
+			}
+			if (py::isinstance<py::float_>(val) && std::isnan(PyFloat_AsDouble(val))) {
+				out_mask.SetInvalid(row);
+				continue;
+			}
+			if (!py::isinstance<py::str>(val)) {
+				if (!gil) {
+					gil = make_uniq<PythonGILWrapper>();
+				}
+				bind_data.object_str_val.Push(std::move(py::str(val)));
+				val = reinterpret_cast<PyObject *>(bind_data.object_str_val.LastAddedObject().ptr());
+			}
+		}
+		// Python 3 string representation:
+		// https://github.com/python/cpython/blob/3a8fdb28794b2f19f6c8464378fb8b46bce1f5f4/Include/cpython/unicodeobject.h#L79
+		py::handle val_handle(val);
+		if (!py::isinstance<py::str>(val_handle)) {
+			out_mask.SetInvalid(row);
+			continue;
+		}
+		if (PyUtil::PyUnicodeIsCompactASCII(val_handle)) {
+			// ascii string: we can zero copy
+			tgt_ptr[row] = string_t(PyUtil::PyUnicodeData(val_handle), PyUtil::PyUnicodeGetLength(val_handle));
+		} else {
+			// unicode gunk
+			auto ascii_obj = reinterpret_cast<PyASCIIObject *>(val);
+			auto unicode_obj = reinterpret_cast<PyCompactUnicodeObject *>(val);
+			// compact unicode string: is there utf8 data available?
+			if (unicode_obj->utf8) {
+				// there is! zero copy
+				tgt_ptr[row] = string_t(const_char_ptr_cast(unicode_obj->utf8), unicode_obj->utf8_length);
+			} else if (PyUtil::PyUnicodeIsCompact(unicode_obj) &&
+			           !PyUtil::PyUnicodeIsASCII(unicode_obj)) { // NOLINT
+				auto kind = PyUtil::PyUnicodeKind(val_handle);
+				switch (kind) {
+				case PyUnicode_1BYTE_KIND:
+					tgt_ptr[row] = DecodePythonUnicode<Py_UCS1>(PyUtil::PyUnicode1ByteData(val_handle),
+					                                            PyUtil::PyUnicodeGetLength(val_handle), out);
+					break;
+				case PyUnicode_2BYTE_KIND:
+					tgt_ptr[row] = DecodePythonUnicode<Py_UCS2>(PyUtil::PyUnicode2ByteData(val_handle),
+					                                            PyUtil::PyUnicodeGetLength(val_handle), out);
+					break;
+				case PyUnicode_4BYTE_KIND:
+					tgt_ptr[row] = DecodePythonUnicode<Py_UCS4>(PyUtil::PyUnicode4ByteData(val_handle),
+					                                            PyUtil::PyUnicodeGetLength(val_handle), out);
+					break;
+				default:
+					throw NotImplementedException("Unsupported typekind constant %d for Python Unicode Compact decode",
+					                              kind);
+				}
+			} else {
+				throw InvalidInputException("Unsupported string type: no clue what this string is");
+			}
+		}
+	}
+}
+
 //! 'offset' is the offset within the column
 //! 'count' is the amount of values we will convert in this batch
 void NumpyScan::Scan(PandasColumnBindData &bind_data, idx_t count, idx_t offset, Vector &out) {
 	D_ASSERT(bind_data.pandas_col->Backend() == PandasColumnBackend::NUMPY);
 	auto &numpy_col = reinterpret_cast<PandasNumpyColumn &>(*bind_data.pandas_col);
-	auto &array = numpy_col.array;
-	auto stride = numpy_col.stride;
 
 	switch (bind_data.numpy_type.type) {
 	case NumpyNullableType::BOOL:
@@ -234,210 +614,55 @@ void NumpyScan::Scan(PandasColumnBindData &bind_data, idx_t count, idx_t offset,
 		ScanNumpyMasked<int64_t>(bind_data, count, offset, out);
 		break;
 	case NumpyNullableType::FLOAT_32:
-		ScanNumpyFpColumn<float>(bind_data, reinterpret_cast<const float *>(array.data()), numpy_col.stride, count,
-		                         offset, out);
+		ScanNumpyFpColumn<float>(bind_data, count, offset, out);
 		break;
 	case NumpyNullableType::FLOAT_64:
-		ScanNumpyFpColumn<double>(bind_data, reinterpret_cast<const double *>(array.data()), numpy_col.stride, count,
-		                          offset, out);
+		ScanNumpyFpColumn<double>(bind_data, count, offset, out);
 		break;
 	case NumpyNullableType::DATETIME_NS:
+		if (bind_data.numpy_type.has_timezone) {
+			// Our timezone type is US, so we need to convert from NS to US
+			ScanNumpyDatetimeColumn<NanosecondsToMicros>(numpy_col, count, offset, out);
+		} else {
+			ScanNumpyDatetimeColumn(numpy_col, count, offset, out);
+		}
+		break;
 	case NumpyNullableType::DATETIME_MS:
-	case NumpyNullableType::DATETIME_US:
-	case NumpyNullableType::DATETIME_S: {
-		auto src_ptr = reinterpret_cast<const int64_t *>(array.data());
-		auto tgt_ptr = FlatVector::GetData<timestamp_t>(out);
-		auto &mask = FlatVector::Validity(out);
-
-		using timestamp_convert_func = std::function<timestamp_t(int64_t)>;
-		timestamp_convert_func convert_func;
-
-		switch (bind_data.numpy_type.type) {
-		case NumpyNullableType::DATETIME_NS:
-			if (bind_data.numpy_type.has_timezone) {
-				// Our timezone type is US, so we need to convert from NS to US
-				convert_func = Timestamp::FromEpochNanoSeconds;
-			} else {
-				convert_func = Timestamp::FromEpochMicroSeconds;
-			}
-			break;
-		case NumpyNullableType::DATETIME_MS:
-			if (bind_data.numpy_type.has_timezone) {
-				// Our timezone type is US, so we need to convert from MS to US
-				convert_func = Timestamp::FromEpochMs;
-			} else {
-				convert_func = Timestamp::FromEpochMicroSeconds;
-			}
-			break;
-		case NumpyNullableType::DATETIME_US:
-			convert_func = Timestamp::FromEpochMicroSeconds;
-			break;
-		case NumpyNullableType::DATETIME_S:
-			if (bind_data.numpy_type.has_timezone) {
-				// Our timezone type is US, so we need to convert from S to US
-				convert_func = Timestamp::FromEpochSeconds;
-			} else {
-				convert_func = Timestamp::FromEpochMicroSeconds;
-			}
-			break;
-		default:
-			throw NotImplementedException("Scan for datetime of this type is not supported yet");
-		};
-
-		for (idx_t row = 0; row < count; row++) {
-			auto source_idx = stride / sizeof(int64_t) * (row + offset);
-			if (src_ptr[source_idx] <= NumericLimits<int64_t>::Minimum()) {
-				// pandas Not a Time (NaT)
-				mask.SetInvalid(row);
-				continue;
-			}
-
-			// Direct conversion, we've already matched the numpy type with the equivalent duckdb type
-			auto input = timestamp_t(src_ptr[source_idx]);
-			if (Timestamp::IsFinite(input)) {
-				tgt_ptr[row] = convert_func(src_ptr[source_idx]);
-			} else {
-				tgt_ptr[row] = input;
-			}
+		if (bind_data.numpy_type.has_timezone) {
+			// Our timezone type is US, so we need to convert from MS to US
+			ScanNumpyDatetimeColumn<MillisecondsToMicros>(numpy_col, count, offset, out);
+		} else {
+			ScanNumpyDatetimeColumn(numpy_col, count, offset, out);
 		}
 		break;
-	}
-	case NumpyNullableType::TIMEDELTA: {
-		auto src_ptr = reinterpret_cast<const int64_t *>(array.data());
-		auto tgt_ptr = FlatVector::GetData<interval_t>(out);
-		auto &mask = FlatVector::Validity(out);
-
-		for (idx_t row = 0; row < count; row++) {
-			auto source_idx = stride / sizeof(int64_t) * (row + offset);
-			if (src_ptr[source_idx] <= NumericLimits<int64_t>::Minimum()) {
-				// pandas Not a Time (NaT)
-				mask.SetInvalid(row);
-				continue;
-			}
-			int64_t micro = src_ptr[source_idx] / 1000;
-			int64_t days = micro / Interval::MICROS_PER_DAY;
-			micro = micro % Interval::MICROS_PER_DAY;
-			int64_t months = days / Interval::DAYS_PER_MONTH;
-			days = days % Interval::DAYS_PER_MONTH;
-			interval_t interval;
-			interval.months = months;
-			interval.days = days;
-			interval.micros = micro;
-			tgt_ptr[row] = interval;
+	case NumpyNullableType::DATETIME_US:
+		ScanNumpyDatetimeColumn(numpy_col, count, offset, out);
+		break;
+	case NumpyNullableType::DATETIME_S:
+		if (bind_data.numpy_type.has_timezone) {
+			// Our timezone type is US, so we need to convert from S to US
+			ScanNumpyDatetimeColumn<SecondsToMicros>(numpy_col, count, offset, out);
+		} else {
+			ScanNumpyDatetimeColumn(numpy_col, count, offset, out);
 		}
 		break;
-	}
+	case NumpyNullableType::TIMEDELTA:
+		ScanNumpyTimedeltaColumn(numpy_col, count, offset, out);
+		break;
 	case NumpyNullableType::STRING:
-	case NumpyNullableType::OBJECT: {
-		// Get the source pointer of the numpy array
-		auto src_ptr = (PyObject **)array.data(); // NOLINT
-		const bool is_object_col = bind_data.numpy_type.type == NumpyNullableType::OBJECT;
-		if (is_object_col && out.GetType().id() != LogicalTypeId::VARCHAR) {
-			//! We have determined the underlying logical type of this object column
-			return NumpyScan::ScanObjectColumn(src_ptr, numpy_col.stride, count, offset, out);
-		}
-
-		// Get the data pointer and the validity mask of the result vector
-		auto tgt_ptr = FlatVector::GetData<string_t>(out);
-		auto &out_mask = FlatVector::Validity(out);
-		unique_ptr<PythonGILWrapper> gil;
-		auto &import_cache = *DuckDBPyConnection::ImportCache();
-
-		// Loop over every row of the arrays contents
-		auto stride = numpy_col.stride;
-		for (idx_t row = 0; row < count; row++) {
-			auto source_idx = stride / sizeof(PyObject *) * (row + offset);
-
-			// Get the pointer to the object
-			PyObject *val = src_ptr[source_idx];
-			if (!py::isinstance<py::str>(val)) {
-				if (val == Py_None) {
-					out_mask.SetInvalid(row);
-					continue;
-				}
-				if (import_cache.pandas.NaT(false)) {
-					// If pandas is imported, check if this is pandas.NaT
-					py::handle value(val);
-					if (value.is(import_cache.pandas.NaT())) {
-						out_mask.SetInvalid(row);
-						continue;
-					}
-				}
-				if (import_cache.pandas.NA(false)) {
-					// If pandas is imported, check if this is pandas.NA
-					py::handle value(val);
-					if (value.is(import_cache.pandas.NA())) {
-						out_mask.SetInvalid(row);
-						continue;
-					}
-				}
-				if (py::isinstance<py::float_>(val) && std::isnan(PyFloat_AsDouble(val))) {
-					out_mask.SetInvalid(row);
-					continue;
-				}
-				if (!py::isinstance<py::str>(val)) {
-					if (!gil) {
-						gil = make_uniq<PythonGILWrapper>();
-					}
-					bind_data.object_str_val.Push(std::move(py::str(val)));
-					val = reinterpret_cast<PyObject *>(bind_data.object_str_val.LastAddedObject().ptr());
-				}
-			}
-			// Python 3 string representation:
-			// https://github.com/python/cpython/blob/3a8fdb28794b2f19f6c8464378fb8b46bce1f5f4/Include/cpython/unicodeobject.h#L79
-			py::handle val_handle(val);
-			if (!py::isinstance<py::str>(val_handle)) {
-				out_mask.SetInvalid(row);
-				continue;
-			}
-			if (PyUtil::PyUnicodeIsCompactASCII(val_handle)) {
-				// ascii string: we can zero copy
-				tgt_ptr[row] = string_t(PyUtil::PyUnicodeData(val_handle), PyUtil::PyUnicodeGetLength(val_handle));
-			} else {
-				// unicode gunk
-				auto ascii_obj = reinterpret_cast<PyASCIIObject *>(val);
-				auto unicode_obj = reinterpret_cast<PyCompactUnicodeObject *>(val);
-				// compact unicode string: is there utf8 data available?
-				if (unicode_obj->utf8) {
-					// there is! zero copy
-					tgt_ptr[row] = string_t(const_char_ptr_cast(unicode_obj->utf8), unicode_obj->utf8_length);
-				} else if (PyUtil::PyUnicodeIsCompact(unicode_obj) &&
-				           !PyUtil::PyUnicodeIsASCII(unicode_obj)) { // NOLINT
-					auto kind = PyUtil::PyUnicodeKind(val_handle);
-					switch (kind) {
-					case PyUnicode_1BYTE_KIND:
-						tgt_ptr[row] = DecodePythonUnicode<Py_UCS1>(PyUtil::PyUnicode1ByteData(val_handle),
-						                                            PyUtil::PyUnicodeGetLength(val_handle), out);
-						break;
-					case PyUnicode_2BYTE_KIND:
-						tgt_ptr[row] = DecodePythonUnicode<Py_UCS2>(PyUtil::PyUnicode2ByteData(val_handle),
-						                                            PyUtil::PyUnicodeGetLength(val_handle), out);
-						break;
-					case PyUnicode_4BYTE_KIND:
-						tgt_ptr[row] = DecodePythonUnicode<Py_UCS4>(PyUtil::PyUnicode4ByteData(val_handle),
-						                                            PyUtil::PyUnicodeGetLength(val_handle), out);
-						break;
-					default:
-						throw NotImplementedException(
-						    "Unsupported typekind constant %d for Python Unicode Compact decode", kind);
-					}
-				} else {
-					throw InvalidInputException("Unsupported string type: no clue what this string is");
-				}
-			}
-		}
+	case NumpyNullableType::OBJECT:
+		ScanPythonObjectColumn(bind_data, count, offset, out, nullptr);
 		break;
-	}
 	case NumpyNullableType::CATEGORY: {
 		switch (out.GetType().InternalType()) {
 		case PhysicalType::UINT8:
-			ScanNumpyCategory<uint8_t>(array, count, offset, out, bind_data.internal_categorical_type);
+			ScanNumpyCategory<uint8_t>(numpy_col, count, offset, out, bind_data.internal_categorical_type);
 			break;
 		case PhysicalType::UINT16:
-			ScanNumpyCategory<uint16_t>(array, count, offset, out, bind_data.internal_categorical_type);
+			ScanNumpyCategory<uint16_t>(numpy_col, count, offset, out, bind_data.internal_categorical_type);
 			break;
 		case PhysicalType::UINT32:
-			ScanNumpyCategory<uint32_t>(array, count, offset, out, bind_data.internal_categorical_type);
+			ScanNumpyCategory<uint32_t>(numpy_col, count, offset, out, bind_data.internal_categorical_type);
 			break;
 		default:
 			throw InternalException("Invalid Physical Type for ENUMs");
@@ -450,4 +675,20 @@ void NumpyScan::Scan(PandasColumnBindData &bind_data, idx_t count, idx_t offset,
 	}
 }
 
+void NumpyScan::ScanSelection(PandasColumnBindData &bind_data, idx_t count, idx_t offset, const SelectionVector &sel,
+                              idx_t sel_count, Vector &out) {
+	switch (bind_data.numpy_type.type) {
+	case NumpyNullableType::STRING:
+	case NumpyNullableType::OBJECT:
+		// Converting Python objects is expensive, only convert the selected rows
+		ScanPythonObjectColumn(bind_data, sel_count, offset, out, &sel);
+		break;
+	default:
+		// The other columns are (mostly) zero-copy, slicing the scanned vector is cheaper than gathering the rows
+		Scan(bind_data, count, offset, out);
+		out.Slice(sel, sel_count);
+		break;
+	}
+}
+
 } // namespace duckdb
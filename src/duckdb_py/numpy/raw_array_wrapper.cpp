@@ -59,14 +59,43 @@ static idx_t GetNumpyTypeWidth(const LogicalType &type) {
 	case LogicalTypeId::UNION:
 	case LogicalTypeId::UUID:
 	case LogicalTypeId::ARRAY:
+	case LogicalTypeId::BIGNUM:
 		return sizeof(PyObject *);
 	default:
 		throw NotImplementedException("Unsupported type \"%s\" for DuckDB -> NumPy conversion", type.ToString());
 	}
 }
 
-RawArrayWrapper::RawArrayWrapper(const LogicalType &type) : data(nullptr), type(type), count(0) {
-	type_width = GetNumpyTypeWidth(type);
+RawArrayWrapper::RawArrayWrapper(const LogicalType &type, bool array_as_2d)
+    : data(nullptr), type(type), count(0), array_size(0) {
+	if (array_as_2d && SupportsArray2D(type)) {
+		array_size = ArrayType::GetSize(type);
+		type_width = GetNumpyTypeWidth(ArrayType::GetChildType(type)) * array_size;
+	} else {
+		type_width = GetNumpyTypeWidth(type);
+	}
+}
+
+bool RawArrayWrapper::SupportsArray2D(const LogicalType &type) {
+	if (type.id() != LogicalTypeId::ARRAY) {
+		return false;
+	}
+	switch (ArrayType::GetChildType(type).id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
 }
 
 string RawArrayWrapper::DuckDBToNumpyDtype(const LogicalType &type) {
@@ -120,6 +149,8 @@ string RawArrayWrapper::DuckDBToNumpyDtype(const LogicalType &type) {
 	case LogicalTypeId::UNION:
 	case LogicalTypeId::UUID:
 	case LogicalTypeId::ARRAY:
+	case LogicalTypeId::BIGNUM:
+		// arbitrary precision integers are stored as Python ints
 		return "object";
 	case LogicalTypeId::ENUM: {
 		auto size = EnumType::GetSize(type);
@@ -139,14 +170,22 @@ string RawArrayWrapper::DuckDBToNumpyDtype(const LogicalType &type) {
 }
 
 void RawArrayWrapper::Initialize(idx_t capacity) {
-	string dtype = DuckDBToNumpyDtype(type);
-
-	array = py::array(py::dtype(dtype), capacity);
+	if (array_size) {
+		// the elements of a row are stored contiguously, in C order
+		string dtype = DuckDBToNumpyDtype(ArrayType::GetChildType(type));
+		vector<py::ssize_t> shape {py::ssize_t(capacity), py::ssize_t(array_size)};
+		array = py::array(py::dtype(dtype), shape);
+	} else {
+		string dtype = DuckDBToNumpyDtype(type);
+		array = py::array(py::dtype(dtype), capacity);
+	}
 	data = data_ptr_cast(array.mutable_data());
 }
 
 void RawArrayWrapper::Resize(idx_t new_capacity) {
-	vector<py::ssize_t> new_shape {py::ssize_t(new_capacity)};
+	// only the amount of rows changes, the row size of a 2-D array is kept
+	vector<py::ssize_t> new_shape(array.shape(), array.shape() + array.ndim());
+	new_shape[0] = py::ssize_t(new_capacity);
 	array.resize(new_shape, false);
 	data = data_ptr_cast(array.mutable_data());
 }
@@ -61,20 +61,28 @@ static LogicalType BindColumn(PandasBindColumn &column_p, PandasColumnBindData &
 		// for category types, we create an ENUM type for string or use the converted numpy type for the rest
 		D_ASSERT(py::hasattr(column, "cat"));
 		D_ASSERT(py::hasattr(column.attr("cat"), "categories"));
-		auto categories = py::array(column.attr("cat").attr("categories"));
+		auto categories_index = column.attr("cat").attr("categories");
+		auto categories = py::array(categories_index);
 		auto categories_pd_type = ConvertNumpyType(categories.attr("dtype"));
 		if (categories_pd_type.type == NumpyNullableType::OBJECT) {
 			// Let's hope the object type is a string.
 			bind_data.numpy_type.type = NumpyNullableType::CATEGORY;
-			vector<string> enum_entries = py::cast<vector<string>>(categories);
-			idx_t size = enum_entries.size();
-			Vector enum_entries_vec(LogicalType::VARCHAR, size);
-			auto enum_entries_ptr = FlatVector::GetData<string_t>(enum_entries_vec);
-			for (idx_t i = 0; i < size; i++) {
-				enum_entries_ptr[i] = StringVector::AddStringOrBlob(enum_entries_vec, enum_entries[i]);
+			auto &import_cache = *DuckDBPyConnection::ImportCache();
+			auto cached_type = import_cache.GetEnumType(categories_index);
+			if (cached_type) {
+				column_type = *cached_type;
+			} else {
+				vector<string> enum_entries = py::cast<vector<string>>(categories);
+				idx_t size = enum_entries.size();
+				Vector enum_entries_vec(LogicalType::VARCHAR, size);
+				auto enum_entries_ptr = FlatVector::GetData<string_t>(enum_entries_vec);
+				for (idx_t i = 0; i < size; i++) {
+					enum_entries_ptr[i] = StringVector::AddStringOrBlob(enum_entries_vec, enum_entries[i]);
+				}
+				column_type = LogicalType::ENUM(enum_entries_vec, size);
+				import_cache.AddEnumType(categories_index, column_type);
 			}
 			D_ASSERT(py::hasattr(column.attr("cat"), "codes"));
-			column_type = LogicalType::ENUM(enum_entries_vec, size);
 			auto pandas_col = py::array(column.attr("cat").attr("codes"));
 			bind_data.internal_categorical_type = string(py::str(pandas_col.attr("dtype")));
 			bind_data.pandas_col = make_uniq<PandasNumpyColumn>(pandas_col);
@@ -110,6 +118,7 @@ static LogicalType BindColumn(PandasBindColumn &column_p, PandasColumnBindData &
 		PandasAnalyzer analyzer(context);
 		if (analyzer.Analyze(column)) {
 			column_type = analyzer.AnalyzedType();
+			bind_data.object_scan_type = NumpyScan::GetObjectScanType(column_type);
 		}
 	}
 	return column_type;
@@ -8,6 +8,9 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb_python/pandas/column/pandas_numpy_column.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "duckdb/planner/filter/table_filter.hpp"
+#include "duckdb/planner/table_filter_state.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 
 #include "duckdb/common/atomic.hpp"
 
@@ -35,6 +38,18 @@ struct PandasScanFunctionData : public TableFunctionData {
 	}
 };
 
+//! A pushed down filter on one of the scanned columns
+struct PandasScanFilter {
+	PandasScanFilter(idx_t column_idx, const TableFilter &filter, unique_ptr<TableFilterState> state)
+	    : column_idx(column_idx), filter(filter), state(std::move(state)) {
+	}
+
+	//! The index of the filtered column in 'column_ids'
+	idx_t column_idx;
+	const TableFilter &filter;
+	unique_ptr<TableFilterState> state;
+};
+
 struct PandasScanLocalState : public LocalTableFunctionState {
 	PandasScanLocalState(idx_t start, idx_t end) : start(start), end(end), batch_index(0) {
 	}
@@ -43,6 +58,9 @@ struct PandasScanLocalState : public LocalTableFunctionState {
 	idx_t end;
 	idx_t batch_index;
 	vector<column_t> column_ids;
+	vector<PandasScanFilter> filters;
+	//! Whether the column in 'column_ids' has a filter
+	vector<bool> filtered_columns;
 };
 
 struct PandasScanGlobalState : public GlobalTableFunctionState {
@@ -67,6 +85,8 @@ PandasScanFunction::PandasScanFunction()
 	table_scan_progress = PandasProgress;
 	serialize = PandasSerialize;
 	projection_pushdown = true;
+	filter_pushdown = true;
+	filter_prune = false;
 }
 
 OperatorPartitionData PandasScanFunction::PandasScanGetPartitionData(ClientContext &context,
@@ -123,6 +143,14 @@ unique_ptr<LocalTableFunctionState> PandasScanFunction::PandasScanInitLocal(Exec
                                                                             GlobalTableFunctionState *gstate) {
 	auto result = make_uniq<PandasScanLocalState>(0, 0);
 	result->column_ids = input.column_ids;
+	result->filtered_columns.resize(input.column_ids.size(), false);
+	if (input.filters) {
+		for (auto &entry : input.filters->filters) {
+			auto &filter = *entry.second;
+			result->filters.emplace_back(entry.first, filter, TableFilterState::Initialize(context.client, filter));
+			result->filtered_columns[entry.first] = true;
+		}
+	}
 	PandasScanParallelStateNext(context.client, input.bind_data.get(), result.get(), gstate);
 	return std::move(result);
 }
@@ -180,30 +208,105 @@ void PandasScanFunction::PandasBackendScanSwitch(PandasColumnBindData &bind_data
 	}
 }
 
+//! Scan the rows of the filtered columns and evaluate the filters on them
+//! Returns the amount of rows that pass all filters, 'sel' holds them if that is not every row
+static idx_t PandasScanFilters(PandasScanFunctionData &data, PandasScanLocalState &state, idx_t count,
+                               DataChunk &output, SelectionVector &sel) {
+	for (idx_t idx = 0; idx < state.column_ids.size(); idx++) {
+		if (!state.filtered_columns[idx]) {
+			continue;
+		}
+		auto col_idx = state.column_ids[idx];
+		if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+			output.data[idx].Sequence(state.start, 1, count);
+			output.data[idx].Flatten(count);
+		} else {
+			PandasScanFunction::PandasBackendScanSwitch(data.pandas_bind_data[col_idx], count, state.start,
+			                                            output.data[idx]);
+		}
+	}
+	idx_t approved_tuple_count = count;
+	for (auto &filter : state.filters) {
+		auto &vector = output.data[filter.column_idx];
+		UnifiedVectorFormat vdata;
+		vector.ToUnifiedFormat(count, vdata);
+		ColumnSegment::FilterSelection(sel, vector, vdata, filter.filter, *filter.state, count, approved_tuple_count);
+		if (approved_tuple_count == 0) {
+			break;
+		}
+	}
+	return approved_tuple_count;
+}
+
 //! The main pandas scan function: note that this can be called in parallel without the GIL
 //! hence this needs to be GIL-safe, i.e. no methods that create Python objects are allowed
 void PandasScanFunction::PandasScanFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &data = data_p.bind_data->CastNoConst<PandasScanFunctionData>();
 	auto &state = data_p.local_state->Cast<PandasScanLocalState>();
 
-	if (state.start >= state.end) {
-		if (!PandasScanParallelStateNext(context, data_p.bind_data.get(), data_p.local_state.get(),
-		                                 data_p.global_state.get())) {
+	while (true) {
+		if (state.start >= state.end) {
+			if (!PandasScanParallelStateNext(context, data_p.bind_data.get(), data_p.local_state.get(),
+			                                 data_p.global_state.get())) {
+				return;
+			}
+		}
+		idx_t this_count = std::min((idx_t)STANDARD_VECTOR_SIZE, state.end - state.start);
+		if (state.filters.empty()) {
+			output.SetCardinality(this_count);
+			for (idx_t idx = 0; idx < state.column_ids.size(); idx++) {
+				auto col_idx = state.column_ids[idx];
+				if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+					output.data[idx].Sequence(state.start, 1, this_count);
+				} else {
+					PandasBackendScanSwitch(data.pandas_bind_data[col_idx], this_count, state.start, output.data[idx]);
+				}
+			}
+			state.start += this_count;
+			data.lines_read += this_count;
 			return;
 		}
-	}
-	idx_t this_count = std::min((idx_t)STANDARD_VECTOR_SIZE, state.end - state.start);
-	output.SetCardinality(this_count);
-	for (idx_t idx = 0; idx < state.column_ids.size(); idx++) {
-		auto col_idx = state.column_ids[idx];
-		if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
-			output.data[idx].Sequence(state.start, 1, this_count);
-		} else {
-			PandasBackendScanSwitch(data.pandas_bind_data[col_idx], this_count, state.start, output.data[idx]);
+
+		// Only the filtered columns are scanned completely, the other columns only convert the rows that qualify
+		SelectionVector sel;
+		auto approved_count = PandasScanFilters(data, state, this_count, output, sel);
+		if (approved_count == 0) {
+			// Returning an empty chunk would end the scan, move on to the next rows instead
+			state.start += this_count;
+			data.lines_read += this_count;
+			output.Reset();
+			continue;
+		}
+		output.SetCardinality(approved_count);
+		for (idx_t idx = 0; idx < state.column_ids.size(); idx++) {
+			auto col_idx = state.column_ids[idx];
+			auto &result = output.data[idx];
+			if (approved_count == this_count) {
+				if (state.filtered_columns[idx]) {
+					continue;
+				}
+				if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+					result.Sequence(state.start, 1, this_count);
+				} else {
+					PandasBackendScanSwitch(data.pandas_bind_data[col_idx], this_count, state.start, result);
+				}
+				continue;
+			}
+			if (state.filtered_columns[idx]) {
+				result.Slice(sel, approved_count);
+			} else if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+				result.Sequence(state.start, 1, this_count);
+				result.Slice(sel, approved_count);
+			} else {
+				auto &bind_data = data.pandas_bind_data[col_idx];
+				D_ASSERT(bind_data.pandas_col->Backend() == PandasColumnBackend::NUMPY);
+				NumpyScan::ScanSelection(bind_data, this_count, state.start, sel, approved_count, result);
+			}
 		}
+		state.start += this_count;
+		data.lines_read += this_count;
+		return;
 	}
-	state.start += this_count;
-	data.lines_read += this_count;
 }
 
 unique_ptr<NodeStatistics> PandasScanFunction::PandasScanCardinality(ClientContext &context,
@@ -190,13 +190,17 @@ static void InitializeConnectionMethods(py::class_<DuckDBPyConnection, shared_pt
 	m.def("fetchmany", &DuckDBPyConnection::FetchMany, "Fetch the next set of rows from a result following execute",
 	      py::arg("size") = 1);
 	m.def("fetchall", &DuckDBPyConnection::FetchAll, "Fetch all rows from a result following execute");
-	m.def("fetchnumpy", &DuckDBPyConnection::FetchNumpy, "Fetch a result as list of NumPy arrays following execute");
+	m.def("fetchnumpy", &DuckDBPyConnection::FetchNumpy, "Fetch a result as list of NumPy arrays following execute",
+	      py::kw_only(), py::arg("arrays_2d") = false, py::arg("decimal_as") = "float");
 	m.def("fetchdf", &DuckDBPyConnection::FetchDF, "Fetch a result as DataFrame following execute()", py::kw_only(),
-	      py::arg("date_as_object") = false);
+	      py::arg("date_as_object") = false, py::arg("categorical_strings") = false);
 	m.def("fetch_df", &DuckDBPyConnection::FetchDF, "Fetch a result as DataFrame following execute()", py::kw_only(),
-	      py::arg("date_as_object") = false);
+	      py::arg("date_as_object") = false, py::arg("categorical_strings") = false);
 	m.def("df", &DuckDBPyConnection::FetchDF, "Fetch a result as DataFrame following execute()", py::kw_only(),
-	      py::arg("date_as_object") = false);
+	      py::arg("date_as_object") = false, py::arg("categorical_strings") = false);
+	m.def("fetch_numpy_batches", &DuckDBPyConnection::FetchNumpyBatches,
+	      "Fetch the result as an iterator of dicts of NumPy arrays of 'batch_size' rows following execute()",
+	      py::arg("batch_size"), py::kw_only(), py::arg("reuse_buffers") = false);
 	m.def("fetch_df_chunk", &DuckDBPyConnection::FetchDFChunk,
 	      "Fetch a chunk of the result as DataFrame following execute()", py::arg("vectors_per_chunk") = 1,
 	      py::kw_only(), py::arg("date_as_object") = false);
@@ -205,9 +209,10 @@ static void InitializeConnectionMethods(py::class_<DuckDBPyConnection, shared_pt
 	m.def("fetch_arrow_table", &DuckDBPyConnection::FetchArrow, "Fetch a result as Arrow table following execute()",
 	      py::arg("rows_per_batch") = 1000000);
 	m.def("fetch_record_batch", &DuckDBPyConnection::FetchRecordBatchReader,
-	      "Fetch an Arrow RecordBatchReader following execute()", py::arg("rows_per_batch") = 1000000);
+	      "Fetch an Arrow RecordBatchReader following execute()", py::arg("rows_per_batch") = 1000000, py::kw_only(),
+	      py::arg("prefetch_batches") = 0);
 	m.def("arrow", &DuckDBPyConnection::FetchRecordBatchReader, "Fetch an Arrow RecordBatchReader following execute()",
-	      py::arg("rows_per_batch") = 1000000);
+	      py::arg("rows_per_batch") = 1000000, py::kw_only(), py::arg("prefetch_batches") = 0);
 	m.def("torch", &DuckDBPyConnection::FetchPyTorch, "Fetch a result as dict of PyTorch Tensors following execute()");
 	m.def("tf", &DuckDBPyConnection::FetchTF, "Fetch a result as dict of TensorFlow Tensors following execute()");
 	m.def("begin", &DuckDBPyConnection::Begin, "Start a new transaction");
@@ -1976,20 +1981,20 @@ py::list DuckDBPyConnection::FetchAll() {
 	return result.FetchAll();
 }
 
-py::dict DuckDBPyConnection::FetchNumpy() {
+py::dict DuckDBPyConnection::FetchNumpy(bool arrays_2d, const string &decimal_as) {
 	if (!con.HasResult()) {
 		throw InvalidInputException("No open result set");
 	}
 	auto &result = con.GetResult();
-	return result.FetchNumpyInternal();
+	return result.FetchNumpy(arrays_2d, decimal_as);
 }
 
-PandasDataFrame DuckDBPyConnection::FetchDF(bool date_as_object) {
+PandasDataFrame DuckDBPyConnection::FetchDF(bool date_as_object, bool categorical_strings) {
 	if (!con.HasResult()) {
 		throw InvalidInputException("No open result set");
 	}
 	auto &result = con.GetResult();
-	return result.FetchDF(date_as_object);
+	return result.FetchDF(date_as_object, categorical_strings);
 }
 
 PandasDataFrame DuckDBPyConnection::FetchDFChunk(const idx_t vectors_per_chunk, bool date_as_object) {
@@ -2000,6 +2005,29 @@ PandasDataFrame DuckDBPyConnection::FetchDFChunk(const idx_t vectors_per_chunk,
 	return result.FetchDFChunk(vectors_per_chunk, date_as_object);
 }
 
+py::object DuckDBPyConnection::FetchNumpyBatches(idx_t batch_size, bool reuse_buffers) {
+	if (!con.HasResult()) {
+		throw InvalidInputException("No open result set");
+	}
+	auto batch_result = con.GetResult().GetResult();
+	if (!batch_result) {
+		throw InvalidInputException("No open result set");
+	}
+	// the result stays on the connection so it can be mixed with the other fetch methods, the iterator remembers
+	// which result it was created for so it never continues on the result of a later execute()
+	auto connection = shared_from_this();
+	auto next_batch = py::cpp_function([connection, batch_result, batch_size, reuse_buffers]() -> py::object {
+		auto &con = connection->con;
+		if (!con.HasResult() || con.GetResult().GetResult() != batch_result) {
+			throw InvalidInputException("The result set of fetch_numpy_batches() was closed or replaced by executing "
+			                            "a different query on the connection");
+		}
+		return batch_result->FetchNumpyBatch(batch_size, reuse_buffers);
+	});
+	// Equivalent to: iter(next_batch, None)
+	return py::module::import("builtins").attr("iter")(next_batch, py::none());
+}
+
 duckdb::pyarrow::Table DuckDBPyConnection::FetchArrow(idx_t rows_per_batch) {
 	if (!con.HasResult()) {
 		throw InvalidInputException("No open result set");
@@ -2032,12 +2060,13 @@ PolarsDataFrame DuckDBPyConnection::FetchPolars(idx_t rows_per_batch, bool lazy)
 	return result.ToPolars(rows_per_batch, lazy);
 }
 
-duckdb::pyarrow::RecordBatchReader DuckDBPyConnection::FetchRecordBatchReader(const idx_t rows_per_batch) {
+duckdb::pyarrow::RecordBatchReader DuckDBPyConnection::FetchRecordBatchReader(const idx_t rows_per_batch,
+                                                                              const idx_t prefetch_batches) {
 	if (!con.HasResult()) {
 		throw InvalidInputException("No open result set");
 	}
 	auto &result = con.GetResult();
-	return result.FetchRecordBatchReader(rows_per_batch);
+	return result.FetchRecordBatchReader(rows_per_batch, prefetch_batches);
 }
 
 case_insensitive_map_t<Value> TransformPyConfigDict(const py::dict &py_config_dict) {
@@ -291,6 +291,10 @@ Relation &DuckDBPyRelation::GetRel() {
 	return *rel;
 }
 
+const shared_ptr<DuckDBPyResult> &DuckDBPyRelation::GetResult() const {
+	return result;
+}
+
 struct DescribeAggregateInfo {
 	explicit DescribeAggregateInfo(string name_p, bool numeric_only = false)
 	    : name(std::move(name_p)), numeric_only(numeric_only) {
@@ -805,7 +809,7 @@ void DuckDBPyRelation::ExecuteOrThrow(bool stream_result) {
 	result = make_uniq<DuckDBPyResult>(std::move(query_result));
 }
 
-PandasDataFrame DuckDBPyRelation::FetchDF(bool date_as_object) {
+PandasDataFrame DuckDBPyRelation::FetchDF(bool date_as_object, bool categorical_strings) {
 	if (!result) {
 		if (!rel) {
 			return py::none();
@@ -815,7 +819,7 @@ PandasDataFrame DuckDBPyRelation::FetchDF(bool date_as_object) {
 	if (result->IsClosed()) {
 		return py::none();
 	}
-	auto df = result->FetchDF(date_as_object);
+	auto df = result->FetchDF(date_as_object, categorical_strings);
 	result = nullptr;
 	return df;
 }
@@ -862,7 +866,7 @@ py::list DuckDBPyRelation::FetchAll() {
 	return res;
 }
 
-py::dict DuckDBPyRelation::FetchNumpy() {
+py::dict DuckDBPyRelation::FetchNumpy(bool arrays_2d, const string &decimal_as) {
 	if (!result) {
 		if (!rel) {
 			return py::none();
@@ -872,7 +876,7 @@ py::dict DuckDBPyRelation::FetchNumpy() {
 	if (result->IsClosed()) {
 		return py::none();
 	}
-	auto res = result->FetchNumpy();
+	auto res = result->FetchNumpy(arrays_2d, decimal_as);
 	result = nullptr;
 	return res;
 }
@@ -932,6 +936,24 @@ PandasDataFrame DuckDBPyRelation::FetchDFChunk(idx_t vectors_per_chunk, bool dat
 	return result->FetchDFChunk(vectors_per_chunk, date_as_object);
 }
 
+py::object DuckDBPyRelation::FetchNumpyBatches(idx_t batch_size, bool reuse_buffers) {
+	if (!result) {
+		if (!rel) {
+			return py::none();
+		}
+		ExecuteOrThrow(true);
+	}
+	AssertResultOpen();
+	// the iterator takes over the result, like the RecordBatchReader does
+	auto batch_result = std::move(result);
+	result = nullptr;
+	auto next_batch = py::cpp_function([batch_result, batch_size, reuse_buffers]() -> py::object {
+		return batch_result->FetchNumpyBatch(batch_size, reuse_buffers);
+	});
+	// Equivalent to: iter(next_batch, None)
+	return py::module::import("builtins").attr("iter")(next_batch, py::none());
+}
+
 duckdb::pyarrow::Table DuckDBPyRelation::ToArrowTableInternal(idx_t batch_size, bool to_polars) {
 	if (!result) {
 		if (!rel) {
@@ -1004,7 +1026,7 @@ PolarsDataFrame DuckDBPyRelation::ToPolars(idx_t batch_size, bool lazy) {
 	return lazy_frame_produce(*this, polars_schema);
 }
 
-duckdb::pyarrow::RecordBatchReader DuckDBPyRelation::ToRecordBatch(idx_t batch_size) {
+duckdb::pyarrow::RecordBatchReader DuckDBPyRelation::ToRecordBatch(idx_t batch_size, idx_t prefetch_batches) {
 	if (!result) {
 		if (!rel) {
 			return py::none();
@@ -1012,7 +1034,7 @@ duckdb::pyarrow::RecordBatchReader DuckDBPyRelation::ToRecordBatch(idx_t batch_s
 		ExecuteOrThrow(true);
 	}
 	AssertResultOpen();
-	auto res = result->FetchRecordBatchReader(batch_size);
+	auto res = result->FetchRecordBatchReader(batch_size, prefetch_batches);
 	result = nullptr;
 	return res;
 }
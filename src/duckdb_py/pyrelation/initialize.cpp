@@ -52,17 +52,21 @@ static void InitializeConsumers(py::class_<DuckDBPyRelation> &m) {
 	         py::arg("size") = 1)
 	    .def("fetchall", &DuckDBPyRelation::FetchAll, "Execute and fetch all rows as a list of tuples")
 	    .def("fetchnumpy", &DuckDBPyRelation::FetchNumpy,
-	         "Execute and fetch all rows as a Python dict mapping each column to one numpy arrays")
+	         "Execute and fetch all rows as a Python dict mapping each column to one numpy arrays", py::kw_only(),
+	         py::arg("arrays_2d") = false, py::arg("decimal_as") = "float")
 	    .def("df", &DuckDBPyRelation::FetchDF, "Execute and fetch all rows as a pandas DataFrame", py::kw_only(),
-	         py::arg("date_as_object") = false)
+	         py::arg("date_as_object") = false, py::arg("categorical_strings") = false)
 	    .def("fetchdf", &DuckDBPyRelation::FetchDF, "Execute and fetch all rows as a pandas DataFrame", py::kw_only(),
-	         py::arg("date_as_object") = false)
+	         py::arg("date_as_object") = false, py::arg("categorical_strings") = false)
 	    .def("to_df", &DuckDBPyRelation::FetchDF, "Execute and fetch all rows as a pandas DataFrame", py::kw_only(),
-	         py::arg("date_as_object") = false)
+	         py::arg("date_as_object") = false, py::arg("categorical_strings") = false)
+	    .def("fetch_numpy_batches", &DuckDBPyRelation::FetchNumpyBatches,
+	         "Execute and return an iterator of dicts of NumPy arrays of 'batch_size' rows", py::arg("batch_size"),
+	         py::kw_only(), py::arg("reuse_buffers") = false)
 	    .def("fetch_df_chunk", &DuckDBPyRelation::FetchDFChunk, "Execute and fetch a chunk of the rows",
 	         py::arg("vectors_per_chunk") = 1, py::kw_only(), py::arg("date_as_object") = false)
 	    .def("arrow", &DuckDBPyRelation::ToRecordBatch, "Execute and return an Arrow Record Batch Reader that yields all rows",
-	         py::arg("batch_size") = 1000000)
+	         py::arg("batch_size") = 1000000, py::kw_only(), py::arg("prefetch_batches") = 0)
 	    .def("fetch_arrow_table", &DuckDBPyRelation::ToArrowTable, "Execute and fetch all rows as an Arrow Table",
 	         py::arg("batch_size") = 1000000)
 	    .def("to_arrow_table", &DuckDBPyRelation::ToArrowTable, "Execute and fetch all rows as an Arrow Table",
@@ -79,9 +83,11 @@ static void InitializeConsumers(py::class_<DuckDBPyRelation> &m) {
 	m.def("__arrow_c_stream__", &DuckDBPyRelation::ToArrowCapsule, capsule_docs,
 	      py::arg("requested_schema") = py::none());
 	m.def("fetch_record_batch", &DuckDBPyRelation::ToRecordBatch,
-	      "Execute and return an Arrow Record Batch Reader that yields all rows", py::arg("rows_per_batch") = 1000000)
+	      "Execute and return an Arrow Record Batch Reader that yields all rows", py::arg("rows_per_batch") = 1000000,
+	      py::kw_only(), py::arg("prefetch_batches") = 0)
 	.def("fetch_arrow_reader", &DuckDBPyRelation::ToRecordBatch,
-	         "Execute and return an Arrow Record Batch Reader that yields all rows", py::arg("batch_size") = 1000000)
+	         "Execute and return an Arrow Record Batch Reader that yields all rows", py::arg("batch_size") = 1000000,
+	         py::kw_only(), py::arg("prefetch_batches") = 0)
 	.def("record_batch",
 			 [](pybind11::object &self, idx_t rows_per_batch)
 			 {
@@ -2,6 +2,7 @@
 #include "duckdb_python/pyconnection/pyconnection.hpp"
 #include "duckdb_python/pyresult.hpp"
 #include "duckdb_python/python_objects.hpp"
+#include "duckdb_python/python_row_conversion.hpp"
 #include "duckdb_python/numpy/numpy_type.hpp"
 
 #include "duckdb_python/arrow/arrow_array_stream.hpp"
@@ -20,8 +21,14 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/enums/stream_execution_result.hpp"
 #include "duckdb_python/arrow/arrow_export_utils.hpp"
+#include "duckdb_python/arrow/arrow_prefetch_stream.hpp"
 #include "duckdb/main/chunk_scan_state/query_result.hpp"
 #include "duckdb/common/arrow/arrow_query_result.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/arrow/arrow_appender.hpp"
+#include "duckdb/common/types/column/column_data_collection_segment.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
@@ -145,32 +152,64 @@ Optional<py::tuple> DuckDBPyResult::Fetchone() {
 	return res;
 }
 
-py::list DuckDBPyResult::Fetchmany(idx_t size) {
+py::list DuckDBPyResult::FetchRows(idx_t max_rows) {
+	if (!result) {
+		throw InvalidInputException("result closed");
+	}
+	PythonRowConversion conversion(result->types, result->client_properties);
+
 	py::list res;
-	for (idx_t i = 0; i < size; i++) {
-		auto fres = Fetchone();
-		if (fres.is_none()) {
+	idx_t fetched = 0;
+	while (fetched < max_rows) {
+		{
+			D_ASSERT(py::gil_check());
+			py::gil_scoped_release release;
+			if (!current_chunk || chunk_offset >= current_chunk->size()) {
+				current_chunk = FetchNext(*result);
+				chunk_offset = 0;
+			}
+		}
+		if (!current_chunk || current_chunk->size() == 0) {
 			break;
 		}
-		res.append(fres);
+		auto count = MinValue<idx_t>(current_chunk->size() - chunk_offset, max_rows - fetched);
+		auto rows = conversion.Convert(*current_chunk, chunk_offset, count);
+		if (fetched == 0) {
+			res = std::move(rows);
+		} else {
+			// Append the rows of this chunk to the end of the result
+			auto end = static_cast<Py_ssize_t>(fetched);
+			if (PyList_SetSlice(res.ptr(), end, end, rows.ptr()) != 0) {
+				throw py::error_already_set();
+			}
+		}
+		chunk_offset += count;
+		fetched += count;
 	}
 	return res;
 }
 
+py::list DuckDBPyResult::Fetchmany(idx_t size) {
+	return FetchRows(size);
+}
+
 py::list DuckDBPyResult::Fetchall() {
-	py::list res;
-	while (true) {
-		auto fres = Fetchone();
-		if (fres.is_none()) {
-			break;
-		}
-		res.append(fres);
-	}
-	return res;
+	return FetchRows(NumericLimits<idx_t>::Maximum());
 }
 
-py::dict DuckDBPyResult::FetchNumpy() {
-	return FetchNumpyInternal();
+py::dict DuckDBPyResult::FetchNumpy(bool arrays_2d, const string &decimal_as) {
+	bool decimal_as_integer;
+	if (decimal_as == "float") {
+		decimal_as_integer = false;
+	} else if (decimal_as == "int_scaled") {
+		decimal_as_integer = true;
+	} else {
+		throw InvalidInputException("Unrecognized value for 'decimal_as': '%s', expected 'float' or 'int_scaled'",
+		                            decimal_as);
+	}
+	auto conversion =
+	    InitializeNumpyConversion(false, DConstants::INVALID_INDEX, false, arrays_2d, decimal_as_integer);
+	return FetchNumpyInternal(false, 1, std::move(conversion));
 }
 
 void DuckDBPyResult::FillNumpy(py::dict &res, idx_t col_idx, NumpyResultConversion &conversion, const char *name) {
@@ -193,6 +232,19 @@ void DuckDBPyResult::FillNumpy(py::dict &res, idx_t col_idx, NumpyResultConversi
 		if (!conversion.ToPandas()) {
 			res[name] = res[name].attr("to_numpy")();
 		}
+	} else if (conversion.HasStringCategories(col_idx)) {
+		auto &import_cache = *DuckDBPyConnection::ImportCache();
+		auto pandas_categorical = import_cache.pandas.Categorical();
+		if (!pandas_categorical) {
+			throw InvalidInputException("'pandas' is required for this operation but it was not installed");
+		}
+		// Equivalent to: pandas.Categorical.from_codes(codes=[0, 1, 0, -1], categories=['a', 'b'])
+		auto categories = conversion.StringCategories(col_idx);
+		res[name] = pandas_categorical.attr("from_codes")(conversion.ToArray(col_idx),
+		                                                  py::arg("categories") = categories);
+	} else if (conversion.DecimalAsInteger(col_idx)) {
+		// the value of each row is integer * 10 ** -scale
+		res[name] = py::make_tuple(conversion.ToArray(col_idx), DecimalType::GetScale(result->types[col_idx]));
 	} else {
 		res[name] = conversion.ToArray(col_idx);
 	}
@@ -214,7 +266,10 @@ void InsertCategory(QueryResult &result, unordered_map<idx_t, py::list> &categor
 	}
 }
 
-unique_ptr<NumpyResultConversion> DuckDBPyResult::InitializeNumpyConversion(bool pandas) {
+unique_ptr<NumpyResultConversion> DuckDBPyResult::InitializeNumpyConversion(bool pandas, idx_t vectors_per_chunk,
+                                                                           bool categorical_strings,
+                                                                           bool arrays_2d,
+                                                                           bool decimal_as_integer) {
 	if (!result) {
 		throw InvalidInputException("result closed");
 	}
@@ -224,10 +279,14 @@ unique_ptr<NumpyResultConversion> DuckDBPyResult::InitializeNumpyConversion(bool
 		// materialized query result: we know exactly how much space we need
 		auto &materialized = result->Cast<MaterializedQueryResult>();
 		initial_capacity = materialized.RowCount();
+	} else if (vectors_per_chunk != DConstants::INVALID_INDEX) {
+		// streaming a limited amount of vectors: we know the upper bound, up to the size of a single segment
+		auto max_vectors = NumpyResultConversion::SEGMENT_CAPACITY / STANDARD_VECTOR_SIZE;
+		initial_capacity = MinValue<idx_t>(MaxValue<idx_t>(vectors_per_chunk, 1), max_vectors) * STANDARD_VECTOR_SIZE;
 	}
 
-	auto conversion =
-	    make_uniq<NumpyResultConversion>(result->types, initial_capacity, result->client_properties, pandas);
+	auto conversion = make_uniq<NumpyResultConversion>(result->types, initial_capacity, result->client_properties,
+	                                                   pandas, categorical_strings, false, arrays_2d, decimal_as_integer);
 	return conversion;
 }
 
@@ -237,15 +296,13 @@ py::dict DuckDBPyResult::FetchNumpyInternal(bool stream, idx_t vectors_per_chunk
 		throw InvalidInputException("result closed");
 	}
 	if (!conversion_p) {
-		conversion_p = InitializeNumpyConversion();
+		conversion_p = InitializeNumpyConversion(false, stream ? vectors_per_chunk : DConstants::INVALID_INDEX);
 	}
 	auto &conversion = *conversion_p;
 
 	if (result->type == QueryResultType::MATERIALIZED_RESULT) {
 		auto &materialized = result->Cast<MaterializedQueryResult>();
-		for (auto &chunk : materialized.Collection().Chunks()) {
-			conversion.Append(chunk);
-		}
+		conversion.Append(materialized.Collection(), *result->client_properties.client_context);
 		InsertCategory(materialized, categories);
 		materialized.Collection().Reset();
 	} else {
@@ -285,64 +342,13 @@ py::dict DuckDBPyResult::FetchNumpyInternal(bool stream, idx_t vectors_per_chunk
 	return res;
 }
 
-// TODO: unify these with an enum/flag to indicate which conversions to do
-void DuckDBPyResult::ChangeToTZType(PandasDataFrame &df) {
-	auto names = df.attr("columns").cast<vector<string>>();
-
-	for (idx_t i = 0; i < result->ColumnCount(); i++) {
-		if (result->types[i] == LogicalType::TIMESTAMP_TZ) {
-			// first localize to UTC then convert to timezone_config
-			auto utc_local = df[names[i].c_str()].attr("dt").attr("tz_localize")("UTC");
-			df.attr("__setitem__")(names[i].c_str(),
-			                       utc_local.attr("dt").attr("tz_convert")(result->client_properties.time_zone));
-		}
-	}
-}
-
-static py::object ConvertNumpyDtype(py::handle numpy_array) {
-	D_ASSERT(py::gil_check());
+//! Create a timezone-aware array from the (UTC) timestamps, NULL values are already written as NaT
+static py::object ConvertTimestampTZ(py::handle value, const string &time_zone) {
 	auto &import_cache = *DuckDBPyConnection::ImportCache();
-
-	auto dtype = numpy_array.attr("dtype");
-	if (!py::isinstance(numpy_array, import_cache.numpy.ma.masked_array())) {
-		return dtype;
-	}
-
-	auto numpy_type = ConvertNumpyType(dtype);
-	switch (numpy_type.type) {
-	case NumpyNullableType::BOOL: {
-		return import_cache.pandas.BooleanDtype()();
-	}
-	case NumpyNullableType::UINT_8: {
-		return import_cache.pandas.UInt8Dtype()();
-	}
-	case NumpyNullableType::UINT_16: {
-		return import_cache.pandas.UInt16Dtype()();
-	}
-	case NumpyNullableType::UINT_32: {
-		return import_cache.pandas.UInt32Dtype()();
-	}
-	case NumpyNullableType::UINT_64: {
-		return import_cache.pandas.UInt64Dtype()();
-	}
-	case NumpyNullableType::INT_8: {
-		return import_cache.pandas.Int8Dtype()();
-	}
-	case NumpyNullableType::INT_16: {
-		return import_cache.pandas.Int16Dtype()();
-	}
-	case NumpyNullableType::INT_32: {
-		return import_cache.pandas.Int32Dtype()();
-	}
-	case NumpyNullableType::INT_64: {
-		return import_cache.pandas.Int64Dtype()();
-	}
-	case NumpyNullableType::FLOAT_32:
-	case NumpyNullableType::FLOAT_64:
-	case NumpyNullableType::FLOAT_16: // there is no pandas.Float16Dtype
-	default:
-		return dtype;
-	}
+	D_ASSERT(!py::isinstance(value, import_cache.numpy.ma.masked_array()));
+	// pandas < 2 only supports nanoseconds, there the index converts the timestamps to them
+	auto utc_index = import_cache.pandas.DatetimeIndex()(value).attr("tz_localize")("UTC");
+	return utc_index.attr("tz_convert")(time_zone).attr("array");
 }
 
 PandasDataFrame DuckDBPyResult::FrameFromNumpy(bool date_as_object, const py::handle &o) {
@@ -354,24 +360,61 @@ PandasDataFrame DuckDBPyResult::FrameFromNumpy(bool date_as_object, const py::ha
 	}
 
 	py::object items = o.attr("items")();
+	idx_t col_idx = 0;
 	for (const py::handle &item : items) {
 		// Each item is a tuple of (key, value)
 		auto key_value = py::cast<py::tuple>(item);
 		py::handle key = key_value[0];   // Access the first element (key)
 		py::handle value = key_value[1]; // Access the second element (value)
+		auto &type = result->types[col_idx++];
 
-		auto dtype = ConvertNumpyDtype(value);
-		if (py::isinstance(value, import_cache.numpy.ma.masked_array())) {
+		if (type.id() == LogicalTypeId::TIMESTAMP_TZ) {
+			// numpy has no timezone-aware type, the column is created with a DatetimeTZDtype before building the frame
+			o.attr("__setitem__")(key, ConvertTimestampTZ(value, result->client_properties.time_zone));
+			continue;
+		}
+		if (!py::isinstance(value, import_cache.numpy.ma.masked_array())) {
+			continue;
+		}
+		auto data = value.attr("data");
+		auto mask = value.attr("mask");
+		auto dtype = data.attr("dtype");
+		auto numpy_type = ConvertNumpyType(dtype);
+		switch (numpy_type.type) {
+		case NumpyNullableType::BOOL: {
+			// The nullable extension arrays are built directly on top of the data and mask buffers
+			o.attr("__setitem__")(key, import_cache.pandas.arrays.BooleanArray()(data, mask));
+			break;
+		}
+		case NumpyNullableType::UINT_8:
+		case NumpyNullableType::UINT_16:
+		case NumpyNullableType::UINT_32:
+		case NumpyNullableType::UINT_64:
+		case NumpyNullableType::INT_8:
+		case NumpyNullableType::INT_16:
+		case NumpyNullableType::INT_32:
+		case NumpyNullableType::INT_64: {
+			o.attr("__setitem__")(key, import_cache.pandas.arrays.IntegerArray()(data, mask));
+			break;
+		}
+		case NumpyNullableType::FLOAT_32:
+		case NumpyNullableType::FLOAT_64: {
+			// there is no nullable dtype for floats here, NULL values are represented as NaN
+			py::module::import("numpy").attr("putmask")(data, mask, py::float_(NAN));
+			o.attr("__setitem__")(key, data);
+			break;
+		}
+		default: {
 			// o[key] = pd.Series(value.filled(pd.NA), dtype=dtype)
-			auto series = pandas.attr("Series")(value.attr("data"), py::arg("dtype") = dtype);
-			series.attr("__setitem__")(value.attr("mask"), import_cache.pandas.NA());
+			auto series = pandas.attr("Series")(data, py::arg("dtype") = dtype);
+			series.attr("__setitem__")(mask, import_cache.pandas.NA());
 			o.attr("__setitem__")(key, series);
+			break;
+		}
 		}
 	}
 
 	PandasDataFrame df = py::cast<PandasDataFrame>(pandas.attr("DataFrame").attr("from_dict")(o));
-	// Unfortunately we have to do a type change here for timezones since these types are not supported by numpy
-	ChangeToTZType(df);
 
 	auto names = df.attr("columns").cast<vector<string>>();
 	D_ASSERT(result->ColumnCount() == names.size());
@@ -385,16 +428,68 @@ PandasDataFrame DuckDBPyResult::FrameFromNumpy(bool date_as_object, const py::ha
 	return df;
 }
 
-PandasDataFrame DuckDBPyResult::FetchDF(bool date_as_object) {
-	auto conversion = InitializeNumpyConversion(true);
+PandasDataFrame DuckDBPyResult::FetchDF(bool date_as_object, bool categorical_strings) {
+	auto conversion = InitializeNumpyConversion(true, DConstants::INVALID_INDEX, categorical_strings);
 	return FrameFromNumpy(date_as_object, FetchNumpyInternal(false, 1, std::move(conversion)));
 }
 
 PandasDataFrame DuckDBPyResult::FetchDFChunk(idx_t num_of_vectors, bool date_as_object) {
-	auto conversion = InitializeNumpyConversion(true);
+	auto conversion = InitializeNumpyConversion(true, num_of_vectors);
 	return FrameFromNumpy(date_as_object, FetchNumpyInternal(true, num_of_vectors, std::move(conversion)));
 }
 
+py::object DuckDBPyResult::FetchNumpyBatch(idx_t batch_size, bool reuse_buffers) {
+	if (!result) {
+		throw InvalidInputException("result closed");
+	}
+	if (batch_size == 0) {
+		throw InvalidInputException("batch_size must be larger than 0");
+	}
+	if (!batch_conversion || batch_conversion_size != batch_size || !reuse_buffers) {
+		batch_conversion = make_uniq<NumpyResultConversion>(result->types, batch_size, result->client_properties,
+		                                                    false, false, reuse_buffers);
+		batch_conversion_size = batch_size;
+	} else {
+		batch_conversion->Reset();
+	}
+	auto &conversion = *batch_conversion;
+
+	idx_t fetched = 0;
+	while (fetched < batch_size) {
+		{
+			D_ASSERT(py::gil_check());
+			py::gil_scoped_release release;
+			if (!current_chunk || chunk_offset >= current_chunk->size()) {
+				current_chunk = FetchNext(*result);
+				chunk_offset = 0;
+			}
+		}
+		if (!current_chunk || current_chunk->size() == 0) {
+			break;
+		}
+		auto count = MinValue<idx_t>(current_chunk->size() - chunk_offset, batch_size - fetched);
+		conversion.Append(*current_chunk, chunk_offset, count);
+		chunk_offset += count;
+		fetched += count;
+	}
+	if (fetched == 0) {
+		batch_conversion.reset();
+		return py::none();
+	}
+	InsertCategory(*result, categories);
+
+	py::dict res;
+	auto names = result->names;
+	QueryResult::DeduplicateColumns(names);
+	for (idx_t col_idx = 0; col_idx < result->names.size(); col_idx++) {
+		FillNumpy(res, col_idx, conversion, names[col_idx].c_str());
+	}
+	if (!reuse_buffers) {
+		batch_conversion.reset();
+	}
+	return std::move(res);
+}
+
 py::dict DuckDBPyResult::FetchPyTorch() {
 	auto result_dict = FetchNumpyInternal();
 	auto from_numpy = py::module::import("torch").attr("from_numpy");
@@ -404,15 +499,148 @@ py::dict DuckDBPyResult::FetchPyTorch() {
 	return result_dict;
 }
 
+//! Whether the array can be handed over through DLPack, which shares the buffer instead of copying it
+//! Masked arrays (columns with NULLs) and non-numeric dtypes have no DLPack representation
+static bool SupportsDLPackExport(const py::handle &array) {
+	auto &import_cache = *DuckDBPyConnection::ImportCache();
+	if (!py::type::of(array).is(import_cache.numpy.ndarray())) {
+		return false;
+	}
+	if (!py::hasattr(array, "__dlpack__")) {
+		// numpy < 1.22
+		return false;
+	}
+	auto kind = py::str(array.attr("dtype").attr("kind")).cast<string>();
+	if (kind != "i" && kind != "u" && kind != "f") {
+		return false;
+	}
+	return py::cast<bool>(array.attr("flags").attr("c_contiguous"));
+}
+
 py::dict DuckDBPyResult::FetchTF() {
 	auto result_dict = FetchNumpyInternal();
-	auto convert_to_tensor = py::module::import("tensorflow").attr("convert_to_tensor");
+	auto tensorflow = py::module::import("tensorflow");
+	auto convert_to_tensor = tensorflow.attr("convert_to_tensor");
+	auto from_dlpack = tensorflow.attr("experimental").attr("dlpack").attr("from_dlpack");
 	for (auto &item : result_dict) {
-		result_dict[item.first] = convert_to_tensor(item.second);
+		if (SupportsDLPackExport(item.second)) {
+			// convert_to_tensor copies the buffer, importing it through DLPack does not
+			result_dict[item.first] = from_dlpack(item.second.attr("__dlpack__")());
+		} else {
+			result_dict[item.first] = convert_to_tensor(item.second);
+		}
 	}
 	return result_dict;
 }
 
+//! Converts the batches [batch_begin, batch_end) of a materialized result into Arrow arrays
+class ArrowConvertBatchesTask : public BaseExecutorTask {
+public:
+	ArrowConvertBatchesTask(TaskExecutor &executor, ColumnDataCollection &collection, const vector<idx_t> &chunk_offsets,
+	                        idx_t rows_per_batch, idx_t batch_begin, idx_t batch_end, vector<ArrowArray> &arrays,
+	                        const ClientProperties &options, ClientContext &context)
+	    : BaseExecutorTask(executor), collection(collection), chunk_offsets(chunk_offsets),
+	      rows_per_batch(rows_per_batch), batch_begin(batch_begin), batch_end(batch_end), arrays(arrays),
+	      options(options), context(context) {
+	}
+
+	void ExecuteTask() override {
+		auto &types = collection.Types();
+		auto row_count = collection.Count();
+		auto extension_types = ArrowTypeExtensionData::GetExtensionTypes(context, types);
+
+		DataChunk chunk;
+		collection.InitializeScanChunk(chunk);
+		auto first_row = batch_begin * rows_per_batch;
+		auto chunk_idx = static_cast<idx_t>(
+		    std::upper_bound(chunk_offsets.begin(), chunk_offsets.end(), first_row) - chunk_offsets.begin() - 1);
+		auto loaded_chunk = DConstants::INVALID_INDEX;
+		for (idx_t batch_idx = batch_begin; batch_idx < batch_end; batch_idx++) {
+			auto row = batch_idx * rows_per_batch;
+			auto end_row = MinValue<idx_t>(row + rows_per_batch, row_count);
+			ArrowAppender appender(types, end_row - row, options, extension_types);
+			while (row < end_row) {
+				if (loaded_chunk != chunk_idx) {
+					collection.FetchChunk(chunk_idx, chunk);
+					loaded_chunk = chunk_idx;
+				}
+				// a chunk can be split over two batches, in which case it is appended in two parts
+				auto chunk_start = chunk_offsets[chunk_idx];
+				auto from = row - chunk_start;
+				auto to = MinValue<idx_t>(chunk.size(), end_row - chunk_start);
+				appender.Append(chunk, from, to, chunk.size());
+				row += to - from;
+				if (to == chunk.size()) {
+					chunk_idx++;
+				}
+			}
+			arrays[batch_idx] = appender.Finalize();
+		}
+	}
+
+private:
+	ColumnDataCollection &collection;
+	const vector<idx_t> &chunk_offsets;
+	idx_t rows_per_batch;
+	idx_t batch_begin;
+	idx_t batch_end;
+	vector<ArrowArray> &arrays;
+	const ClientProperties &options;
+	ClientContext &context;
+};
+
+//! Converts a materialized result into Arrow arrays of 'rows_per_batch' rows on the thread pool
+//! The batches are identical to the ones produced by ArrowUtil::FetchChunk, returns false if the conversion should
+//! happen on this thread instead
+static bool FetchArrowArraysParallel(MaterializedQueryResult &result, idx_t rows_per_batch,
+                                     vector<ArrowArray> &arrays) {
+	auto &context = *result.client_properties.client_context;
+	auto &collection = result.Collection();
+	auto row_count = collection.Count();
+	if (rows_per_batch == 0) {
+		return false;
+	}
+	auto batch_count = (row_count + rows_per_batch - 1) / rows_per_batch;
+	auto thread_count = static_cast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	if (thread_count <= 1 || batch_count <= 1) {
+		return false;
+	}
+
+	// the first row of every chunk, so every task can start reading at its first batch
+	vector<idx_t> chunk_offsets;
+	chunk_offsets.reserve(collection.ChunkCount());
+	idx_t offset = 0;
+	for (auto &segment : collection.GetSegments()) {
+		for (auto &chunk_data : segment->chunk_data) {
+			chunk_offsets.push_back(offset);
+			offset += chunk_data.count;
+		}
+	}
+	D_ASSERT(offset == row_count);
+
+	arrays.resize(batch_count);
+	auto task_count = MinValue<idx_t>(thread_count, batch_count);
+	TaskExecutor executor(context);
+	for (idx_t task_idx = 0; task_idx < task_count; task_idx++) {
+		auto batch_begin = batch_count * task_idx / task_count;
+		auto batch_end = batch_count * (task_idx + 1) / task_count;
+		executor.ScheduleTask(make_uniq<ArrowConvertBatchesTask>(executor, collection, chunk_offsets, rows_per_batch,
+		                                                         batch_begin, batch_end, arrays,
+		                                                         result.client_properties, context));
+	}
+	try {
+		executor.WorkOnTasks();
+	} catch (...) {
+		for (auto &array : arrays) {
+			if (array.release) {
+				array.release(&array);
+			}
+		}
+		throw;
+	}
+	return true;
+}
+
 duckdb::pyarrow::Table DuckDBPyResult::FetchArrowTable(idx_t rows_per_batch, bool to_polars) {
 	if (!result) {
 		throw InvalidInputException("There is no query result");
@@ -428,6 +656,14 @@ duckdb::pyarrow::Table DuckDBPyResult::FetchArrowTable(idx_t rows_per_batch, boo
 	auto pyarrow_lib_module = py::module::import("pyarrow").attr("lib");
 
 	py::list batches;
+	vector<ArrowArray> parallel_arrays;
+	bool parallel_conversion = false;
+	if (result->type == QueryResultType::MATERIALIZED_RESULT) {
+		D_ASSERT(py::gil_check());
+		py::gil_scoped_release release;
+		parallel_conversion = FetchArrowArraysParallel(result->Cast<MaterializedQueryResult>(), rows_per_batch,
+		                                               parallel_arrays);
+	}
 	if (result->type == QueryResultType::ARROW_RESULT) {
 		auto &arrow_result = result->Cast<ArrowQueryResult>();
 		auto arrays = arrow_result.ConsumeArrays();
@@ -443,6 +679,18 @@ duckdb::pyarrow::Table DuckDBPyResult::FetchArrowTable(idx_t rows_per_batch, boo
 			                              arrow_result.client_properties);
 			TransformDuckToArrowChunk(arrow_schema, data, batches);
 		}
+	} else if (parallel_conversion) {
+		// only importing the converted batches into pyarrow requires the GIL
+		auto result_names = result->names;
+		if (to_polars) {
+			QueryResult::DeduplicateColumns(result_names);
+		}
+		for (auto &data : parallel_arrays) {
+			ArrowSchema arrow_schema;
+			ArrowConverter::ToArrowSchema(&arrow_schema, result->types, result_names, result->client_properties);
+			TransformDuckToArrowChunk(arrow_schema, data, batches);
+		}
+		result->Cast<MaterializedQueryResult>().Collection().Reset();
 	} else {
 		QueryResultChunkScanState scan_state(*result.get());
 		while (true) {
@@ -473,24 +721,28 @@ duckdb::pyarrow::Table DuckDBPyResult::FetchArrowTable(idx_t rows_per_batch, boo
 	return pyarrow::ToArrowTable(result->types, names, std::move(batches), result->client_properties);
 }
 
-ArrowArrayStream DuckDBPyResult::FetchArrowArrayStream(idx_t rows_per_batch) {
+ArrowArrayStream DuckDBPyResult::FetchArrowArrayStream(idx_t rows_per_batch, idx_t prefetch_batches) {
 	if (!result) {
 		throw InvalidInputException("There is no query result");
 	}
 	ResultArrowArrayStreamWrapper *result_stream = new ResultArrowArrayStreamWrapper(std::move(result), rows_per_batch);
 	// The 'result_stream' is part of the 'private_data' of the ArrowArrayStream and its lifetime is bound to that of
 	// the ArrowArrayStream.
+	if (prefetch_batches > 0) {
+		return PrefetchArrowArrayStreamWrapper::Create(result_stream->stream, prefetch_batches);
+	}
 	return result_stream->stream;
 }
 
-duckdb::pyarrow::RecordBatchReader DuckDBPyResult::FetchRecordBatchReader(idx_t rows_per_batch) {
+duckdb::pyarrow::RecordBatchReader DuckDBPyResult::FetchRecordBatchReader(idx_t rows_per_batch,
+                                                                          idx_t prefetch_batches) {
 	if (!result) {
 		throw InvalidInputException("There is no query result");
 	}
 	py::gil_scoped_acquire acquire;
 	auto pyarrow_lib_module = py::module::import("pyarrow").attr("lib");
 	auto record_batch_reader_func = pyarrow_lib_module.attr("RecordBatchReader").attr("_import_from_c");
-	auto stream = FetchArrowArrayStream(rows_per_batch);
+	auto stream = FetchArrowArrayStream(rows_per_batch, prefetch_batches);
 	py::object record_batch_reader = record_batch_reader_func((uint64_t)&stream); // NOLINT
 	return py::cast<duckdb::pyarrow::RecordBatchReader>(record_batch_reader);
 }
@@ -1,6 +1,7 @@
 #include "duckdb_python/import_cache/python_import_cache.hpp"
 #include "duckdb_python/import_cache/python_import_cache_item.hpp"
 #include "duckdb/common/stack.hpp"
+#include "duckdb/common/types/interval.hpp"
 #include "duckdb_python/import_cache/importer.hpp"
 
 namespace duckdb {
@@ -82,6 +83,8 @@ PythonImportCache::~PythonImportCache() {
 	try {
 		py::gil_scoped_acquire acquire;
 		owned_objects.clear();
+		time_zones.clear();
+		enum_types.clear();
 	} catch (...) { // NOLINT
 	}
 }
@@ -92,4 +95,74 @@ py::handle PythonImportCache::AddCache(py::object item) {
 	return object_ptr;
 }
 
+const PythonTimeZone &PythonImportCache::GetTimeZone(const string &name) {
+	auto entry = time_zones.find(name);
+	if (entry != time_zones.end()) {
+		return entry->second;
+	}
+	PythonTimeZone time_zone;
+	time_zone.tzinfo = pytz.timezone()(name);
+	// Time zones with DST transitions (pytz's DstTzInfo) have to be resolved for every value
+	if (!py::hasattr(time_zone.tzinfo, "_utc_transition_times")) {
+		auto offset = time_zone.tzinfo.attr("utcoffset")(py::none());
+		if (!offset.is_none()) {
+			auto days = py::cast<int64_t>(offset.attr("days"));
+			auto seconds = py::cast<int64_t>(offset.attr("seconds"));
+			auto microseconds = py::cast<int64_t>(offset.attr("microseconds"));
+			time_zone.has_fixed_offset = true;
+			time_zone.utc_offset_micros =
+			    (days * Interval::SECS_PER_DAY + seconds) * Interval::MICROS_PER_SEC + microseconds;
+		}
+	}
+	return time_zones.emplace(name, std::move(time_zone)).first->second;
+}
+
+//! Categorical columns of many different frames are rare, when this many types are cached the cache starts over
+static constexpr const idx_t ENUM_TYPE_CACHE_CAPACITY = 64;
+
+//! The buffer holding the categories, writing new values into the Index replaces it
+static const void *GetCategoriesData(py::handle categories) {
+	auto values = categories.attr("values");
+	if (py::isinstance<py::array>(values)) {
+		return py::cast<py::array>(values).data();
+	}
+	// the categories are backed by an extension array, which owns its buffers
+	return values.ptr();
+}
+
+optional_ptr<const LogicalType> PythonImportCache::GetEnumType(py::handle categories) {
+	auto size = py::len(categories);
+	auto data = GetCategoriesData(categories);
+	auto entry = enum_types.find(categories.ptr());
+	if (entry == enum_types.end()) {
+		return nullptr;
+	}
+	if (entry->second.size != size || entry->second.data != data) {
+		// the categories were modified in place since the type was created
+		enum_types.erase(entry);
+		return nullptr;
+	}
+	return entry->second.type;
+}
+
+void PythonImportCache::AddEnumType(py::handle categories, LogicalType type) {
+	auto key = categories.ptr();
+	PythonEnumType enum_type;
+	enum_type.size = py::len(categories);
+	enum_type.data = GetCategoriesData(categories);
+	enum_type.type = std::move(type);
+	// the entry does not keep the categories alive, it is removed before their address can be reused
+	auto remove_entry = py::cpp_function([this, key](py::handle) { enum_types.erase(key); });
+	try {
+		enum_type.categories = py::weakref(categories, remove_entry);
+	} catch (py::error_already_set &) {
+		// the categories can not be referenced weakly, don't cache the type
+		return;
+	}
+	if (enum_types.size() >= ENUM_TYPE_CACHE_CAPACITY) {
+		enum_types.clear();
+	}
+	enum_types[key] = std::move(enum_type);
+}
+
 } // namespace duckdb
@@ -154,3 +154,74 @@ class TestDBApiFetch(object):
         """
         res = duckdb_cursor.sql(query).fetchone()
         assert 'key' in res[0].keys()
+
+    @pytest.mark.parametrize('size', [1, 7, 2047, 2048, 2049, 5000])
+    def test_fetch_many_chunk_boundaries(self, duckdb_cursor, size):
+        duckdb_cursor.execute('SELECT i, i::VARCHAR FROM range(10000) t(i)')
+        expected = [(i, str(i)) for i in range(10000)]
+        result = []
+        while True:
+            rows = duckdb_cursor.fetchmany(size)
+            if not rows:
+                break
+            assert len(rows) <= size
+            result.extend(rows)
+        assert result == expected
+
+    def test_fetch_mixed_one_many_all(self, duckdb_cursor):
+        duckdb_cursor.execute('SELECT i FROM range(5000) t(i)')
+        assert duckdb_cursor.fetchone() == (0,)
+        assert duckdb_cursor.fetchmany(3) == [(1,), (2,), (3,)]
+        assert duckdb_cursor.fetchone() == (4,)
+        assert duckdb_cursor.fetchall() == [(i,) for i in range(5, 5000)]
+        assert duckdb_cursor.fetchone() is None
+
+    def test_fetch_all_matches_fetch_one(self, duckdb_cursor):
+        query = """
+            SELECT
+                i % 2 = 0 AS b, i::TINYINT AS ti, i::UBIGINT AS ubi, -i::HUGEINT AS hi, i / 3 AS d,
+                i::VARCHAR AS s, i::VARCHAR::BLOB AS bl, i::DECIMAL(18, 3) AS dec,
+                DATE '2000-01-01' + i::INTEGER AS dt, TIME '01:02:03' AS tm,
+                TIMESTAMP '2000-01-01 01:02:03.456789' + to_seconds(i) AS ts,
+                TIMESTAMP_MS '2000-01-01 01:02:03.456' AS ts_ms, TIMESTAMP_NS '2000-01-01 01:02:03.456789' AS ts_ns,
+                TIMESTAMP_S '2000-01-01 01:02:03' AS ts_s, [i, NULL] AS l, {'a': i} AS st,
+                CASE WHEN i % 3 = 0 THEN NULL ELSE i END AS n
+            FROM range(3000) t(i)
+        """
+        expected = []
+        duckdb_cursor.execute(query)
+        while True:
+            row = duckdb_cursor.fetchone()
+            if row is None:
+                break
+            expected.append(row)
+        assert duckdb_cursor.execute(query).fetchall() == expected
+
+    def test_fetch_all_infinite_values(self, duckdb_cursor):
+        res = duckdb_cursor.execute(
+            "SELECT 'infinity'::DATE, '-infinity'::TIMESTAMP, NULL::TIMESTAMP, DATE '1992-01-01'"
+        ).fetchall()
+        assert res == [(datetime.date.max, datetime.datetime.min, None, datetime.date(1992, 1, 1))]
+
+    def test_fetch_uuid_and_time(self, duckdb_cursor):
+        query = """
+            SELECT * FROM (VALUES
+                ('00000000-0000-0000-0000-000000000000'::UUID, TIME '00:00:00'),
+                ('cd57dfbd-d65f-4e15-991e-2a92e74b9f79'::UUID, TIME '23:59:59.999999'),
+                ('ffffffff-ffff-ffff-ffff-ffffffffffff'::UUID, TIME '24:00:00'),
+                (NULL, NULL)
+            )
+        """
+        expected = [
+            (UUID('00000000-0000-0000-0000-000000000000'), datetime.time(0, 0)),
+            (UUID('cd57dfbd-d65f-4e15-991e-2a92e74b9f79'), datetime.time(23, 59, 59, 999999)),
+            (UUID('ffffffff-ffff-ffff-ffff-ffffffffffff'), '24:00:00'),
+            (None, None),
+        ]
+        res = duckdb_cursor.execute(query).fetchall()
+        assert res == expected
+        assert res[1][0].is_safe == expected[1][0].is_safe
+        assert hash(res[1][0]) == hash(expected[1][0])
+        arrays = duckdb_cursor.execute(query).fetchnumpy()
+        assert list(arrays['col0'][:3]) == [row[0] for row in expected[:3]]
+        assert list(arrays['col1'][:3]) == [row[1] for row in expected[:3]]
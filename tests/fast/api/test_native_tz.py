@@ -31,6 +31,30 @@ class TestNativeTimeZone(object):
         assert res[0].hour == 21 and res[0].minute == 52
         assert res[0].tzinfo.zone == 'UTC'
 
+    @pytest.mark.parametrize('timezone', ['UTC', 'America/Los_Angeles', 'Etc/GMT+5', 'Asia/Kolkata', 'EST'])
+    def test_native_python_timestamp_timezone_many(self, duckdb_cursor, timezone):
+        duckdb_cursor.execute(f"SET timezone='{timezone}'")
+        # hourly values over a year cross the DST transitions of the time zones that have them
+        query = """
+            SELECT CASE WHEN i % 10 = 0 THEN NULL ELSE TIMESTAMPTZ '2021-01-01 00:00:00+00' + i * INTERVAL 1 HOUR END,
+                   epoch_us(TIMESTAMPTZ '2021-01-01 00:00:00+00' + i * INTERVAL 1 HOUR)
+            FROM range(24 * 365) t(i)
+        """
+        tz = pytz.timezone(timezone)
+        epoch = datetime.datetime(1970, 1, 1, tzinfo=pytz.utc)
+        for value, micros in duckdb_cursor.execute(query).fetchall():
+            if value is None:
+                continue
+            expected = (epoch + datetime.timedelta(microseconds=micros)).astimezone(tz)
+            assert value == expected
+            assert value.utcoffset() == expected.utcoffset()
+            assert value.tzinfo is expected.tzinfo
+
+        # the nested conversion goes through the same path
+        res = duckdb_cursor.execute("SELECT [TIMESTAMPTZ '2021-07-01 12:00:00+00']").fetchone()[0][0]
+        assert res == datetime.datetime(2021, 7, 1, 12, tzinfo=pytz.utc)
+        assert res.tzinfo.zone == timezone
+
     def test_native_python_time_timezone(self, duckdb_cursor):
         res = duckdb_cursor.execute(f"select TimeRecStart::TIMETZ as tz from '{filename}'").fetchone()
         assert res == (datetime.time(21, 52, 27, tzinfo=datetime.timezone.utc),)
@@ -48,6 +72,30 @@ class TestNativeTimeZone(object):
         res = duckdb_cursor.execute(f"select TimeRecStart as tz  from '{filename}'").df()
         assert res['tz'][0].hour == 21 and res['tz'][0].minute == 52
 
+    def test_pandas_timestamp_timezone_null(self, duckdb_cursor):
+        duckdb_cursor.execute("SET timezone='America/Los_Angeles';")
+        res = duckdb_cursor.execute(
+            "select * from (values (TIMESTAMPTZ '2022-01-01 12:00:00+00', 1), (NULL, 2)) t(tz, i)"
+        ).df()
+        assert res.dtypes["tz"].tz.zone == 'America/Los_Angeles'
+        if Version(pd.__version__) >= Version('2.0.0'):
+            assert res.dtypes["tz"].unit == 'us'
+        assert res['tz'][0].hour == 4
+        assert res['tz'][1] is pd.NaT
+        assert res['i'].tolist() == [1, 2]
+
+    def test_pandas_timestamp_timezone_nulls_across_chunks(self, duckdb_cursor):
+        duckdb_cursor.execute("SET timezone='UTC';")
+        query = """
+            SELECT CASE WHEN i % 3 = 0 THEN NULL ELSE TIMESTAMPTZ '2022-01-01 00:00:00+00' + to_seconds(i) END AS tz
+            FROM range(5000) t(i)
+        """
+        for res in [duckdb_cursor.execute(query).df(), duckdb_cursor.execute(query).fetch_df_chunk(1)]:
+            rows = len(res)
+            assert res['tz'].isna().tolist() == [i % 3 == 0 for i in range(rows)]
+            assert res['tz'][1] == pd.Timestamp('2022-01-01 00:00:01', tz='UTC')
+            assert res['tz'][rows - 1] == pd.Timestamp('2022-01-01', tz='UTC') + pd.Timedelta(seconds=rows - 1)
+
     def test_pandas_timestamp_time(self, duckdb_cursor):
         with pytest.raises(
             duckdb.NotImplementedException, match="Not implemented Error: Unsupported type \"TIME WITH TIME ZONE\""
@@ -88,3 +88,24 @@ class TestArrowFetch(object):
         assert arrow_tbl['a'].num_chunks == 1
         arrow_tbl = relation.fetch_arrow_table(2048)
         assert arrow_tbl['a'].num_chunks == 2
+
+    @pytest.mark.parametrize('rows_per_batch', [1, 1000, 2048, 4097, 100000])
+    def test_fetch_arrow_table_parallel(self, rows_per_batch):
+        if not can_run:
+            return
+
+        duckdb_cursor = duckdb.connect()
+        duckdb_cursor.execute(
+            "CREATE table t as select range a, range::VARCHAR b, [range, NULL] c, {'x': range} d from range(20000);"
+        )
+        # a union of two tables produces chunks that are not completely filled
+        query = "SELECT * FROM t WHERE a % 3 = 0 UNION ALL SELECT * FROM t WHERE a % 7 = 0 ORDER BY a, b"
+        if rows_per_batch == 1:
+            query += " LIMIT 5000"
+        duckdb_cursor.execute("SET threads=1")
+        expected = duckdb_cursor.execute(query).fetch_arrow_table(rows_per_batch)
+
+        duckdb_cursor.execute("SET threads=4")
+        result = duckdb_cursor.execute(query).fetch_arrow_table(rows_per_batch)
+        assert result.equals(expected)
+        assert [len(batch) for batch in result.to_batches()] == [len(batch) for batch in expected.to_batches()]
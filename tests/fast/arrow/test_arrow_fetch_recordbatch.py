@@ -291,3 +291,49 @@ class TestArrowFetchRecordBatch(object):
                 assert len(chunk) == remainder
             with pytest.raises(StopIteration):
                 chunk = record_batch_reader.read_next_batch()
+
+    @pytest.mark.parametrize('prefetch_batches', [1, 2, 8])
+    def test_record_batch_prefetch(self, prefetch_batches):
+        duckdb_cursor = duckdb.connect()
+        duckdb_cursor.execute("CREATE table t as select range a, range::VARCHAR b from range(10000);")
+        expected = duckdb_cursor.execute("SELECT a, b FROM t ORDER BY a").fetch_record_batch(1024).read_all()
+
+        record_batch_reader = duckdb_cursor.execute("SELECT a, b FROM t ORDER BY a").fetch_record_batch(
+            1024, prefetch_batches=prefetch_batches
+        )
+        assert record_batch_reader.schema.names == ['a', 'b']
+        batches = list(record_batch_reader)
+        assert [len(batch) for batch in batches] == [1024] * 9 + [784]
+        assert pa.Table.from_batches(batches).equals(expected)
+
+        rel_reader = duckdb_cursor.sql("SELECT a, b FROM t ORDER BY a").fetch_record_batch(
+            1024, prefetch_batches=prefetch_batches
+        )
+        assert rel_reader.read_all().equals(expected)
+
+    def test_record_batch_prefetch_scan_pandas(self):
+        pd = pytest.importorskip('pandas')
+        duckdb_cursor = duckdb.connect()
+        df = pd.DataFrame({'a': range(5000), 'b': [str(x) for x in range(5000)]})
+        # Scanning the DataFrame needs the GIL on the background thread
+        reader = duckdb_cursor.execute("SELECT * FROM df").fetch_record_batch(100, prefetch_batches=4)
+        assert reader.read_all().num_rows == 5000
+
+    def test_record_batch_prefetch_release_early(self):
+        duckdb_cursor = duckdb.connect()
+        reader = duckdb_cursor.execute("SELECT range a FROM range(100000)").fetch_record_batch(
+            10, prefetch_batches=2
+        )
+        chunk = reader.read_next_batch()
+        assert len(chunk) == 10
+        # Releasing the reader stops the background thread while it is still producing
+        del reader
+        assert duckdb_cursor.execute("SELECT 42").fetchall() == [(42,)]
+
+    def test_record_batch_prefetch_error(self):
+        duckdb_cursor = duckdb.connect()
+        reader = duckdb_cursor.execute(
+            "SELECT CASE WHEN range < 5000 THEN range ELSE error('boom') END a FROM range(10000)"
+        ).fetch_record_batch(100, prefetch_batches=2)
+        with pytest.raises(OSError, match='boom'):
+            reader.read_all()
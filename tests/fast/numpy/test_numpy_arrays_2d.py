@@ -0,0 +1,52 @@
+import duckdb
+import numpy as np
+import pytest
+
+
+class TestNumpyArrays2D(object):
+    @pytest.mark.parametrize(
+        'child_type, dtype',
+        [('FLOAT', np.float32), ('DOUBLE', np.float64), ('INTEGER', np.int32), ('UTINYINT', np.uint8)],
+    )
+    def test_arrays_2d(self, child_type, dtype):
+        con = duckdb.connect()
+        query = f"SELECT [i, i + 1, i + 2]::{child_type}[3] AS a FROM range(5000) t(i)"
+        result = con.execute(query).fetchnumpy(arrays_2d=True)['a']
+        assert type(result) is np.ndarray
+        assert result.shape == (5000, 3)
+        assert result.dtype == dtype
+        assert result.flags['C_CONTIGUOUS']
+        expected = np.arange(5000)[:, None] + np.arange(3)[None, :]
+        assert np.array_equal(result, expected.astype(dtype))
+
+    def test_arrays_2d_nulls(self):
+        con = duckdb.connect()
+        query = """
+            SELECT CASE WHEN i % 3 = 0 THEN NULL ELSE [i, CASE WHEN i % 5 = 0 THEN NULL ELSE i END]::DOUBLE[2] END AS a
+            FROM range(3000) t(i)
+        """
+        result = con.execute(query).fetchnumpy(arrays_2d=True)['a']
+        assert isinstance(result, np.ma.MaskedArray)
+        assert result.shape == (3000, 2)
+        rows = con.execute(query).fetchall()
+        for i, (expected,) in enumerate(rows):
+            if expected is None:
+                assert result.mask[i].all()
+            else:
+                assert result.mask[i].tolist() == [value is None for value in expected]
+                assert result[i].tolist() == list(expected)
+
+    def test_arrays_2d_relation(self):
+        con = duckdb.connect()
+        rel = con.sql("SELECT [1, 2]::BIGINT[2] AS a, [[1], [2]]::INTEGER[1][2] AS nested, 'x' AS s")
+        result = rel.fetchnumpy(arrays_2d=True)
+        assert result['a'].shape == (1, 2)
+        # ARRAY types with a non fixed-width child are still converted to an object array
+        assert result['nested'].dtype == object
+        assert result['s'][0] == 'x'
+
+    def test_arrays_2d_default(self):
+        con = duckdb.connect()
+        result = con.execute("SELECT [1, 2]::INTEGER[2] AS a").fetchnumpy()['a']
+        assert result.dtype == object
+        assert result[0].tolist() == [1, 2]
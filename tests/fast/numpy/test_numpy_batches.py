@@ -0,0 +1,80 @@
+import duckdb
+import numpy as np
+import pytest
+
+
+QUERY = """
+    SELECT
+        i AS i, i::DOUBLE / 3 AS d, i::VARCHAR AS s,
+        CASE WHEN i % 7 = 0 THEN NULL ELSE i END AS n
+    FROM range(10000) t(i)
+"""
+
+
+def concatenate(batches, column):
+    return np.ma.concatenate([batch[column] for batch in batches])
+
+
+class TestNumpyBatches(object):
+    @pytest.mark.parametrize('batch_size', [1, 1000, 2048, 3000, 20000])
+    def test_fetch_numpy_batches(self, batch_size):
+        con = duckdb.connect()
+        expected = con.execute(QUERY).fetchnumpy()
+
+        batches = list(con.execute(QUERY).fetch_numpy_batches(batch_size))
+        sizes = [len(batch['i']) for batch in batches]
+        assert all(size == batch_size for size in sizes[:-1])
+        assert sum(sizes) == 10000
+        for column in ['i', 'd', 's', 'n']:
+            assert np.ma.allequal(concatenate(batches, column), expected[column])
+        assert np.array_equal(np.ma.getmaskarray(concatenate(batches, 'n')), np.ma.getmaskarray(expected['n']))
+
+    def test_fetch_numpy_batches_relation(self):
+        con = duckdb.connect()
+        rel = con.sql(QUERY)
+        batches = list(rel.fetch_numpy_batches(4096))
+        assert [len(batch['i']) for batch in batches] == [4096, 4096, 1808]
+        assert np.array_equal(concatenate(batches, 'i'), np.arange(10000))
+
+    def test_fetch_numpy_batches_mixed_with_fetchmany(self):
+        con = duckdb.connect()
+        con.execute("SELECT range i FROM range(5000)")
+        assert con.fetchmany(10) == [(i,) for i in range(10)]
+        batches = con.fetch_numpy_batches(1000)
+        first = next(batches)
+        assert np.array_equal(first['i'], np.arange(10, 1010))
+        assert sum(len(batch['i']) for batch in batches) == 5000 - 1010
+
+    def test_fetch_numpy_batches_reuse_buffers(self):
+        con = duckdb.connect()
+        con.execute("SELECT range i, range::VARCHAR s FROM range(3000)")
+        batches = con.fetch_numpy_batches(1000, reuse_buffers=True)
+        first = next(batches)
+        first_strings = first['s']
+        assert first['i'][0] == 0
+        second = next(batches)
+        # the numeric buffer is reused, the object column is not
+        assert np.shares_memory(first['i'], second['i'])
+        assert first['i'][0] == 1000
+        assert first_strings[0] == '0'
+        assert second['s'][0] == '1000'
+        assert len(list(batches)) == 1
+
+    def test_fetch_numpy_batches_execute_mid_iteration(self):
+        con = duckdb.connect()
+        con.execute("SELECT range i FROM range(5000)")
+        batches = con.fetch_numpy_batches(1000)
+        assert np.array_equal(next(batches)['i'], np.arange(1000))
+        con.execute("SELECT range + 100000 i FROM range(5000)")
+        with pytest.raises(duckdb.InvalidInputException, match='closed or replaced'):
+            next(batches)
+        # the new result is untouched and can still be iterated on its own
+        assert np.array_equal(next(con.fetch_numpy_batches(1000))['i'], np.arange(100000, 101000))
+
+    def test_fetch_numpy_batches_invalid(self):
+        con = duckdb.connect()
+        with pytest.raises(duckdb.InvalidInputException, match='No open result set'):
+            con.fetch_numpy_batches(10)
+        con.execute("SELECT 42")
+        with pytest.raises(duckdb.InvalidInputException, match='batch_size'):
+            next(con.fetch_numpy_batches(0))
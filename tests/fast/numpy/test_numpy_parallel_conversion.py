@@ -0,0 +1,40 @@
+import duckdb
+import numpy as np
+import pytest
+
+
+QUERY = """
+    SELECT
+        i AS i, i::DOUBLE / 3 AS d, i::DECIMAL(18, 2) AS dec, (i % 3 = 0) AS b,
+        TIMESTAMP '2000-01-01' + to_seconds(i) AS ts, DATE '2000-01-01' + (i % 1000)::INTEGER AS dt,
+        to_seconds(i) AS iv, i::VARCHAR AS s, (['a', 'b', 'c'])[(i % 3) + 1]::ENUM('a', 'b', 'c') AS e,
+        CASE WHEN i % 7 = 0 THEN NULL ELSE i END AS n,
+        CASE WHEN i % 11 = 0 THEN NULL ELSE i::VARCHAR END AS ns
+    FROM range(50000) t(i)
+"""
+
+
+class TestNumpyParallelConversion(object):
+    @pytest.mark.parametrize('threads', [1, 4])
+    def test_fetchnumpy_parallel(self, threads):
+        con = duckdb.connect()
+        con.execute(f"SET threads={threads}")
+        res = con.execute(QUERY).fetchnumpy()
+        expected = con.execute(f"SELECT COLUMNS(*)::VARCHAR FROM ({QUERY})").fetchall()
+
+        assert len(res['i']) == 50000
+        np.testing.assert_array_equal(res['i'], np.arange(50000))
+        np.testing.assert_array_equal(res['d'], np.arange(50000) / 3)
+        np.testing.assert_array_equal(res['s'], np.array([str(x) for x in range(50000)], dtype=object))
+        np.testing.assert_array_equal(np.ma.getmaskarray(res['n']), np.arange(50000) % 7 == 0)
+        np.testing.assert_array_equal(np.ma.getmaskarray(res['ns']), np.arange(50000) % 11 == 0)
+        assert [str(x) for x in res['e']] == [row[8] for row in expected]
+
+    def test_df_parallel_matches_single_threaded(self):
+        pd = pytest.importorskip("pandas")
+        con = duckdb.connect()
+        con.execute("SET threads=1")
+        expected = con.execute(QUERY).df()
+        con.execute("SET threads=4")
+        result = con.execute(QUERY).df()
+        pd.testing.assert_frame_equal(result, expected)
@@ -151,3 +151,26 @@ class TestDateTimeTimeStamp(object):
 
         pd.testing.assert_frame_equal(utc_usecond, utc_other)
         pd.testing.assert_frame_equal(us_usecond, us_other)
+
+    @pytest.mark.skipif(Version(pd.__version__) < Version('2.0.0'), reason="pandas < 2.0.0 only supports 'ns'")
+    @pytest.mark.parametrize('unit', ['s', 'ms', 'us', 'ns'])
+    @pytest.mark.parametrize('tz', [None, 'UTC'])
+    def test_timestamp_units_with_nat(self, duckdb_cursor, unit, tz):
+        # The 'ns' values are whole microseconds, so the expected values are exact
+        scale = 1000 if unit == 'ns' else 1
+        factor = {'s': 1_000_000, 'ms': 1_000, 'us': 1, 'ns': 1}[unit]
+        values = [None if i % 7 == 0 else (i - 1500) * 123_457 * scale for i in range(3000)]
+        array = np.array(
+            [np.datetime64('NaT') if v is None else np.datetime64(v, unit) for v in values], dtype=f'datetime64[{unit}]'
+        )
+        series = pd.Series(array)
+        if tz:
+            series = series.dt.tz_localize(tz)
+        df = pd.DataFrame({'t': series, 'i': range(3000)})
+
+        expected = [None if v is None else v // scale * factor for v in values]
+        assert [row[0] for row in duckdb_cursor.sql("select epoch_us(t) from df order by i").fetchall()] == expected
+        # Every other row, the column is no longer contiguous
+        strided = df.iloc[::2]
+        res = duckdb_cursor.sql("select epoch_us(t) from strided order by i").fetchall()
+        assert [row[0] for row in res] == expected[::2]
@@ -608,6 +608,78 @@ class TestResolveObjectColumns(object):
         df_expected_res = pandas.DataFrame({'0': pandas.Series(['4', '2', '0'])})
         pandas.testing.assert_frame_equal(duckdb_col, df_expected_res)
 
+    @pytest.mark.parametrize('pandas', [NumpyPandas()])
+    def test_subclass_object_conversion(self, pandas, duckdb_cursor):
+        class IntSubclass(int):
+            pass
+
+        class StrSubclass(str):
+            pass
+
+        class DecimalSubclass(Decimal):
+            pass
+
+        x = pandas.DataFrame(
+            {
+                'i': pandas.Series([IntSubclass(1), 2, IntSubclass(3)], dtype='object'),
+                's': pandas.Series([StrSubclass('a'), 'b', StrSubclass('c')], dtype='object'),
+                'd': pandas.Series([DecimalSubclass('1.5'), Decimal('2.25'), None], dtype='object'),
+                'o': pandas.Series([IntString(4), IntString(2), None], dtype='object'),
+            }
+        )
+        expected = [(1, 'a', Decimal('1.50'), '4'), (2, 'b', Decimal('2.25'), '2'), (3, 'c', None, None)]
+        # The second scan classifies the objects through the cached types
+        for _ in range(2):
+            assert duckdb_cursor.sql("select * from x").fetchall() == expected
+
+    @pytest.mark.parametrize('pandas', [NumpyPandas()])
+    def test_homogeneous_object_columns(self, pandas, duckdb_cursor):
+        class IntSubclass(int):
+            pass
+
+        size = 5000
+        date = datetime.date(2020, 1, 1)
+        timestamp = datetime.datetime(2020, 1, 1, 12, 30, 15, 250)
+        x = pandas.DataFrame(
+            {
+                'b': pandas.Series([None if i % 7 == 0 else i % 2 == 0 for i in range(size)], dtype='object'),
+                'i': pandas.Series(
+                    [None if i % 7 == 0 else IntSubclass(i) if i % 11 == 0 else i for i in range(size)], dtype='object'
+                ),
+                'f': pandas.Series(
+                    [None if i % 7 == 0 else float('nan') if i % 5 == 0 else i / 2 for i in range(size)],
+                    dtype='object',
+                ),
+                'd': pandas.Series(
+                    [None if i % 7 == 0 else date + datetime.timedelta(days=i) for i in range(size)], dtype='object'
+                ),
+                't': pandas.Series(
+                    [
+                        None if i % 7 == 0 else pandas.Timestamp(timestamp) if i % 3 == 0 else timestamp
+                        for i in range(size)
+                    ],
+                    dtype='object',
+                ),
+            }
+        )
+        res = duckdb_cursor.sql("select * from x").fetchall()
+        assert len(res) == size
+        for i, row in enumerate(res):
+            if i % 7 == 0:
+                assert row == (None, None, None, None, None)
+                continue
+            assert row[0] == (i % 2 == 0)
+            assert row[1] == i
+            assert row[2] == (None if i % 5 == 0 else i / 2)
+            assert row[3] == date + datetime.timedelta(days=i)
+            assert row[4] == timestamp
+
+        # Values of another type than the analyzed one still go through the generic conversion
+        duckdb_cursor.execute("set pandas_analyze_sample=1")
+        x = pandas.DataFrame({'i': pandas.Series([1, 2, 2**63], dtype='object')})
+        with pytest.raises(duckdb.InvalidInputException, match='out of range'):
+            duckdb_cursor.sql("select * from x").fetchall()
+
     @pytest.mark.parametrize('pandas', [NumpyPandas(), ArrowPandas()])
     def test_numeric_decimal(self, pandas, duckdb_cursor):
         # DuckDB uses DECIMAL where possible, so all the 'float' types here are actually DECIMAL
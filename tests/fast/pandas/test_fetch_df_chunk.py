@@ -90,3 +90,25 @@ class TestType(object):
         # Return -1 vector should not work
         with pytest.raises(TypeError, match='incompatible function arguments'):
             cur_chunk = query.fetch_df_chunk(-1)
+
+    def test_fetch_df_segments(self):
+        # streaming more rows than fit in a single segment, the segments are concatenated at the end
+        size = VECTOR_SIZE * 512 + VECTOR_SIZE * 3 + 5
+        con = duckdb.connect()
+        query = con.execute(
+            f"SELECT range a, CASE WHEN range > {VECTOR_SIZE * 512} AND range % 3 = 0 THEN NULL ELSE range END b, "
+            f"range::VARCHAR c FROM range({size})"
+        )
+        df = query.df()
+        assert len(df) == size
+        assert df['a'].tolist() == list(range(size))
+        assert df['b'].isna().sum() == len([x for x in range(VECTOR_SIZE * 512 + 1, size) if x % 3 == 0])
+        assert df['c'][size - 1] == str(size - 1)
+
+    def test_fetch_df_chunk_many_vectors(self):
+        size = VECTOR_SIZE * 10 + 1
+        con = duckdb.connect()
+        query = con.execute(f"SELECT range a FROM range({size})")
+        cur_chunk = query.fetch_df_chunk(100)
+        assert len(cur_chunk) == size
+        assert cur_chunk['a'].tolist() == list(range(size))
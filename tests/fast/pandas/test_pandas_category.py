@@ -1,3 +1,5 @@
+import gc
+import weakref
 import duckdb
 import pandas as pd
 import numpy
@@ -153,3 +155,52 @@ class TestCategory(object):
 
         df_out = duckdb.query_df(df_in, "data", "SELECT * FROM data").df()
         assert df_out.equals(df_in)
+
+    def test_categorical_strings(self, duckdb_cursor):
+        duckdb_cursor.execute(
+            "CREATE TABLE strings AS SELECT CASE WHEN i % 5 = 0 THEN NULL ELSE ['x', 'y', 'z'][(i % 3)::INTEGER + 1] END s, i FROM range(5000) t(i)"
+        )
+        query = "SELECT s, s || '' AS t, i FROM strings ORDER BY i"
+        df = duckdb_cursor.execute(query).df(categorical_strings=True)
+        expected = duckdb_cursor.execute(query).df()
+        assert isinstance(df['s'].dtype, pd.CategoricalDtype)
+        assert not df['s'].dtype.ordered
+        assert sorted(df['s'].cat.categories) == ['x', 'y', 'z']
+        assert df['s'].astype(object).where(df['s'].notna(), None).tolist() == expected['s'].tolist()
+        assert df['t'].astype(object).where(df['t'].notna(), None).tolist() == expected['t'].tolist()
+        assert df['i'].tolist() == expected['i'].tolist()
+
+        rel_df = duckdb_cursor.sql("SELECT 'constant' c FROM range(10)").df(categorical_strings=True)
+        assert rel_df['c'].cat.categories.tolist() == ['constant']
+        assert rel_df['c'].cat.codes.tolist() == [0] * 10
+
+        # without the option VARCHAR columns stay object columns
+        assert duckdb_cursor.execute(query).df()['s'].dtype == object
+
+    def test_categorical_repeated_scans(self, duckdb_cursor):
+        # More than 256 categories, so the codes are int16
+        categories = [f'cat_{i}' for i in range(300)]
+        values = [None if i % 11 == 0 else categories[(i * 7) % 300] for i in range(5000)]
+        df = pd.DataFrame({'c': pd.Categorical(values, categories=categories)})
+        assert df['c'].cat.codes.dtype == numpy.int16
+
+        first = duckdb_cursor.sql("SELECT c FROM df")
+        second = duckdb_cursor.sql("SELECT c FROM df")
+        assert first.types == second.types
+        assert first.fetchall() == second.fetchall() == [(v,) for v in values]
+
+        # Different categories result in a different ENUM type
+        renamed = pd.DataFrame({'c': df['c'].cat.rename_categories([f'new_{i}' for i in range(300)])})
+        res = duckdb_cursor.sql("SELECT c FROM renamed").fetchall()
+        assert res == [(None if v is None else v.replace('cat_', 'new_'),) for v in values]
+        assert duckdb_cursor.sql("SELECT c FROM df").fetchall() == [(v,) for v in values]
+
+    def test_categorical_categories_released(self, duckdb_cursor):
+        df = pd.DataFrame({'c': pd.Categorical(['a', 'b', None, 'a'], categories=['a', 'b'])})
+        assert duckdb_cursor.sql("SELECT c FROM df").fetchall() == [('a',), ('b',), (None,), ('a',)]
+
+        # the cached ENUM type does not keep the categories of a dropped frame alive
+        categories = weakref.ref(df['c'].cat.categories)
+        del df
+        gc.collect()
+        assert categories() is None
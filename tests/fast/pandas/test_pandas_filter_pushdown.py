@@ -0,0 +1,73 @@
+import duckdb
+import datetime
+import numpy as np
+import pytest
+import re
+from conftest import NumpyPandas
+
+
+def create_dataframe(pandas, size):
+    start = datetime.datetime(2020, 1, 1)
+    return pandas.DataFrame(
+        {
+            'i': np.arange(size, dtype=np.int64),
+            'f': [float('nan') if i % 13 == 0 else i / 4 for i in range(size)],
+            's': [None if i % 17 == 0 else f'str_{i % 100}' for i in range(size)],
+            'o': pandas.Series([None if i % 19 == 0 else i % 50 for i in range(size)], dtype='object'),
+            't': [start + datetime.timedelta(minutes=i) for i in range(size)],
+        }
+    )
+
+
+FILTERS = [
+    'i = 4321',
+    'i >= 9000',
+    'i < 10 OR i > 9990',
+    'i BETWEEN 2000 AND 2100 AND f > 510',
+    'f IS NULL',
+    'f IS NOT NULL AND f < 3',
+    's = \'str_42\'',
+    's IS NULL AND i < 1000',
+    'o = 7',
+    'o IS NULL',
+    't > TIMESTAMP \'2020-01-07 12:00:00\'',
+    'i IN (1, 5, 5000, 7777)',
+    'i < 0',
+]
+
+
+class TestPandasFilterPushdown(object):
+    @pytest.mark.parametrize('pandas', [NumpyPandas()])
+    @pytest.mark.parametrize('condition', FILTERS)
+    def test_filter_pushdown(self, duckdb_cursor, pandas, condition):
+        df = create_dataframe(pandas, 10000)
+        duckdb_cursor.execute("CREATE TABLE tbl AS SELECT * FROM df")
+        expected = duckdb_cursor.sql(f"SELECT * FROM tbl WHERE {condition} ORDER BY i").fetchall()
+        result = duckdb_cursor.sql(f"SELECT * FROM df WHERE {condition} ORDER BY i").fetchall()
+        assert result == expected
+
+        # Filter on a column that is not projected
+        expected = duckdb_cursor.sql(f"SELECT s, o FROM tbl WHERE {condition} ORDER BY i").fetchall()
+        result = duckdb_cursor.sql(f"SELECT s, o FROM df WHERE {condition} ORDER BY i").fetchall()
+        assert result == expected
+
+    @pytest.mark.parametrize('pandas', [NumpyPandas()])
+    def test_filter_pushdown_explain(self, duckdb_cursor, pandas):
+        df = create_dataframe(pandas, 100)
+        plan = duckdb_cursor.sql("EXPLAIN SELECT * FROM df WHERE i > 50").fetchall()[0][1]
+        assert re.search(r".*PANDAS_SCAN.*Filters:.*i>50.*", plan, flags=re.DOTALL)
+
+    @pytest.mark.parametrize('pandas', [NumpyPandas()])
+    def test_filter_pushdown_sparse_matches(self, duckdb_cursor, pandas):
+        # Most vectors have no qualifying rows, the scan has to continue past them
+        df = create_dataframe(pandas, 100000)
+        result = duckdb_cursor.sql("SELECT i, s FROM df WHERE i % 25000 = 1 AND i > 10 ORDER BY i").fetchall()
+        assert result == [(25001, 'str_1'), (50001, 'str_1'), (75001, 'str_1')]
+        result = duckdb_cursor.sql("SELECT i, s FROM df WHERE i = 99999 OR i = 2").fetchall()
+        assert sorted(result) == [(2, 'str_2'), (99999, 'str_99')]
+
+    @pytest.mark.parametrize('pandas', [NumpyPandas()])
+    def test_filter_pushdown_numpy_dict(self, duckdb_cursor, pandas):
+        data = {'a': np.arange(5000), 'b': np.arange(5000) * 2}
+        result = duckdb_cursor.sql("SELECT a, b FROM data WHERE b > 9990").fetchall()
+        assert result == [(4996, 9992), (4997, 9994), (4998, 9996), (4999, 9998)]
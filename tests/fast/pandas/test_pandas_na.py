@@ -85,3 +85,26 @@ class TestPandasNA(object):
         res = duckdb_cursor.execute("select * from na_string_df").fetchall()
         items = [x[0] for x in [y for y in res]]
         assert_nullness(items, null_indices)
+
+    def test_nullable_result_columns(self, duckdb_cursor):
+        pd = pytest.importorskip('pandas', minversion='1.0.0')
+        df = duckdb_cursor.execute(
+            """
+            SELECT * FROM (VALUES
+                (1::TINYINT, 1::UBIGINT, 1::INTEGER, true, 1.5::DOUBLE, 1.5::FLOAT),
+                (NULL, NULL, NULL, NULL, NULL, NULL),
+                (3::TINYINT, 3::UBIGINT, 3::INTEGER, false, 3.5::DOUBLE, 3.5::FLOAT)
+            ) t(ti, ubi, i, b, d, f)
+            """
+        ).df()
+        assert isinstance(df['ti'].array, pd.arrays.IntegerArray)
+        assert str(df['ti'].dtype) == 'Int8'
+        assert str(df['ubi'].dtype) == 'UInt64'
+        assert str(df['i'].dtype) == 'Int32'
+        assert isinstance(df['b'].array, pd.arrays.BooleanArray)
+        assert str(df['d'].dtype) == 'float64'
+        assert str(df['f'].dtype) == 'float32'
+        assert df['i'].tolist() == [1, pd.NA, 3]
+        assert df['b'].tolist() == [True, pd.NA, False]
+        assert df['d'].isna().tolist() == [False, True, False]
+        assert df['f'][2] == 3.5
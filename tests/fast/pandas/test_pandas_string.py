@@ -43,3 +43,26 @@ class TestPandasString(object):
             ).fetchall()
             == [(3000000,)]
         )
+
+    def test_repeated_strings_share_objects(self, duckdb_cursor):
+        df = duckdb_cursor.execute(
+            "SELECT ['NL', 'BE', NULL][(i % 3)::INTEGER + 1] AS country FROM range(10000) t(i)"
+        ).df()
+        countries = df['country']
+        assert countries[0] == 'NL' and countries[1] == 'BE' and countries[2] is None
+        assert countries[0] is countries[3] and countries[0] is countries[9999]
+        assert countries.isna().sum() == 3333
+
+    def test_high_cardinality_strings(self, duckdb_cursor):
+        # more distinct strings than are cached, the values are still converted correctly
+        res = duckdb_cursor.execute(
+            "SELECT CASE WHEN i % 5 = 0 THEN 'common' ELSE 'value_' || i::VARCHAR END AS s FROM range(20000) t(i)"
+        ).fetchnumpy()['s']
+        assert list(res) == ['common' if i % 5 == 0 else f'value_{i}' for i in range(20000)]
+
+    def test_dictionary_strings(self, duckdb_cursor):
+        duckdb_cursor.execute("CREATE TABLE t AS SELECT (i % 4)::VARCHAR || '_suffix' AS s FROM range(5000) t(i)")
+        res = duckdb_cursor.execute("SELECT s FROM t ORDER BY rowid").fetchnumpy()['s']
+        assert list(res) == [f'{i % 4}_suffix' for i in range(5000)]
+        constant = duckdb_cursor.execute("SELECT 'constant' AS c FROM range(3000)").fetchnumpy()['c']
+        assert list(constant) == ['constant'] * 3000
@@ -65,3 +65,30 @@ class TestPandasStride(object):
         for col in output_df.columns:
             assert str(output_df[col].dtype) == 'float64'
         pd.testing.assert_frame_equal(expected_df, output_df)
+
+    def test_unaligned(self, duckdb_cursor):
+        # Values that are not aligned to their size can not be used in place, they have to be copied
+        buffer = np.zeros(8 * 3000 + 1, dtype=np.uint8)
+        values = np.arange(3000, dtype=np.int64)
+        unaligned = np.frombuffer(buffer.data, dtype=np.int64, offset=1, count=3000)
+        unaligned[:] = values
+        doubles = np.frombuffer(buffer.data, dtype=np.float64, offset=1, count=3000)
+        assert not unaligned.flags.aligned
+
+        df = pd.DataFrame({'i': unaligned}, copy=False)
+        assert duckdb_cursor.sql("select sum(i), min(i), max(i) from df").fetchone() == (
+            int(values.sum()),
+            0,
+            2999,
+        )
+        data = {'i': unaligned, 'd': doubles}
+        res = duckdb_cursor.sql("select i, d from data where i in (0, 1234, 2999) order by i").fetchall()
+        assert res == [(int(i), float(doubles[i])) for i in [0, 1234, 2999]]
+
+    def test_contiguous_large(self, duckdb_cursor):
+        df = pd.DataFrame({'a': np.arange(100000, dtype=np.float64), 'b': np.arange(100000, dtype=np.int32)})
+        assert duckdb_cursor.sql("select sum(a), sum(b), count(*) from df").fetchone() == (
+            4999950000.0,
+            4999950000,
+            100000,
+        )
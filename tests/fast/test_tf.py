@@ -33,3 +33,18 @@ def test_tf():
         duck_numpy = con.sql("select * from t").fetchnumpy()
         tf.math.equal(duck_tf['a'], tf.convert_to_tensor(duck_numpy['a']))
         tf.math.equal(duck_tf['b'], tf.convert_to_tensor(duck_numpy['b']))
+
+
+def test_tf_dlpack_and_fallback():
+    con = duckdb.connect()
+    con.execute(
+        "create table t as select range::INTEGER a, range::DOUBLE b, CASE WHEN range % 2 = 0 THEN range END c, "
+        "range % 3 = 0 d from range(10000)"
+    )
+    duck_tf = con.execute("select * from t").tf()
+    duck_numpy = con.execute("select * from t").fetchnumpy()
+    # columns without NULLs are imported through DLPack, the others through convert_to_tensor
+    for column in ['a', 'b', 'd']:
+        assert duck_tf[column].dtype == tf.as_dtype(duck_numpy[column].dtype)
+        assert tf.reduce_all(tf.math.equal(duck_tf[column], tf.convert_to_tensor(duck_numpy[column])))
+    assert duck_tf['c'].shape == (10000,)
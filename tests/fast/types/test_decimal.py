@@ -24,3 +24,54 @@ class TestDecimal(object):
             'c': numpy.array([320938.4298]),
             'd': numpy.array([49082094824.904820482094]),
         }
+
+    def test_decimal_formatting(self, duckdb_cursor):
+        # the Decimal objects must be identical to parsing DuckDB's own string representation
+        values = [
+            "0::DECIMAL(4,2)",
+            "-0.05::DECIMAL(4,2)",
+            "1.50::DECIMAL(9,2)",
+            "-123456789.123::DECIMAL(18,3)",
+            "12::DECIMAL(18,0)",
+            "-99999999999999999999999999999999999999::DECIMAL(38,0)",
+            "0.00000000000000000000000000000000000001::DECIMAL(38,38)",
+            "-1234567890123456789012.3456789::DECIMAL(38,7)",
+            "1000000000000000000::DECIMAL(38,0)",
+        ]
+        for value in values:
+            result, as_string = duckdb_cursor.execute(f"SELECT {value}, {value}::VARCHAR").fetchone()
+            assert str(result) == str(Decimal(as_string))
+            assert result.as_tuple() == Decimal(as_string).as_tuple()
+
+        rows = duckdb_cursor.execute(
+            "SELECT ((i - 500) / 8)::DECIMAL(9,3), ((i - 500) * 1e20)::DECIMAL(38,2) FROM range(1000) t(i)"
+        ).fetchall()
+        strings = duckdb_cursor.execute(
+            "SELECT ((i - 500) / 8)::DECIMAL(9,3)::VARCHAR, ((i - 500) * 1e20)::DECIMAL(38,2)::VARCHAR FROM range(1000) t(i)"
+        ).fetchall()
+        assert rows == [tuple(Decimal(s) for s in row) for row in strings]
+
+    def test_decimal_numpy_int_scaled(self, duckdb_cursor):
+        duckdb_cursor.execute(
+            'SELECT 1.2::DECIMAL(4,1) AS a, -100.3::DECIMAL(9,2) AS b, 320938.4298::DECIMAL(18,4) AS c, '
+            '49082094824.904820482094::DECIMAL(30,12) AS d, NULL::DECIMAL(18,3) AS e'
+        )
+        result = duckdb_cursor.fetchnumpy(decimal_as='int_scaled')
+        values, scale = result['a']
+        assert values.dtype == numpy.int16 and values.tolist() == [12] and scale == 1
+        values, scale = result['b']
+        assert values.dtype == numpy.int32 and values.tolist() == [-10030] and scale == 2
+        values, scale = result['c']
+        assert values.dtype == numpy.int64 and values.tolist() == [3209384298] and scale == 4
+        values, scale = result['d']
+        assert values.dtype == object and values.tolist() == [49082094824904820482094] and scale == 12
+        values, scale = result['e']
+        assert values.mask.tolist() == [True] and scale == 3
+
+    def test_decimal_numpy_invalid(self, duckdb_cursor):
+        import duckdb
+        import pytest
+
+        duckdb_cursor.execute('SELECT 1.2::DECIMAL(4,1) AS a')
+        with pytest.raises(duckdb.InvalidInputException, match='decimal_as'):
+            duckdb_cursor.fetchnumpy(decimal_as='string')
@@ -12,3 +12,25 @@ class TestHugeint(object):
         duckdb_cursor.execute('SELECT 1::HUGEINT AS i')
         result = duckdb_cursor.fetchnumpy()
         assert result == {'i': numpy.array([1.0])}
+
+    def test_hugeint_boundaries(self, duckdb_cursor):
+        values = [
+            0,
+            -1,
+            2**63 - 1,
+            2**63,
+            -(2**63),
+            -(2**63) - 1,
+            2**64,
+            -(2**64),
+            2**127 - 1,
+            -(2**127),
+        ]
+        query = 'SELECT * FROM (VALUES ' + ', '.join(f"('{v}'::HUGEINT)" for v in values) + ')'
+        assert [row[0] for row in duckdb_cursor.execute(query).fetchall()] == values
+        assert duckdb_cursor.execute(query).fetchnumpy()['col0'].shape == (len(values),)
+
+    def test_uhugeint_boundaries(self, duckdb_cursor):
+        values = [0, 2**63, 2**64 - 1, 2**64, 2**128 - 1]
+        query = 'SELECT * FROM (VALUES ' + ', '.join(f"('{v}'::UHUGEINT)" for v in values) + ')'
+        assert [row[0] for row in duckdb_cursor.execute(query).fetchall()] == values
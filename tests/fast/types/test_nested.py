@@ -51,3 +51,60 @@ class TestNested(object):
 
         result = duckdb_cursor.execute("SELECT MAP() ").fetchall()
         assert result == [({},)]
+
+    def test_nested_fetchnumpy(self, duckdb_cursor):
+        # fetchnumpy converts STRUCT/MAP/UNION column-wise, the values must match the row-wise conversion
+        query = """
+            SELECT
+                CASE WHEN i % 5 = 0 THEN NULL ELSE {'a': i, 'b': i::VARCHAR, 'c': [i, NULL], 'd': row(i, 'x')} END AS s,
+                CASE WHEN i % 7 = 0 THEN NULL ELSE MAP([i, i + 1], [{'x': i}, NULL]) END AS m,
+                MAP([[i]], [i]) AS unhashable,
+                CASE WHEN i % 3 = 0 THEN NULL
+                     WHEN i % 3 = 1 THEN union_value(num := i)::UNION(num INTEGER, str VARCHAR)
+                     ELSE union_value(str := i::VARCHAR)::UNION(num INTEGER, str VARCHAR) END AS u
+            FROM range(5000) t(i)
+        """
+        rows = duckdb_cursor.execute(query).fetchall()
+        result = duckdb_cursor.execute(query).fetchnumpy()
+        for column_idx, name in enumerate(['s', 'm', 'unhashable', 'u']):
+            column = result[name]
+            assert len(column) == len(rows)
+            for row_idx, row in enumerate(rows):
+                expected = row[column_idx]
+                if expected is None:
+                    assert column.mask[row_idx]
+                else:
+                    assert column[row_idx] == expected
+        assert rows[1][0] == {'a': 1, 'b': '1', 'c': [1, None], 'd': (1, 'x')}
+        assert rows[1][2] == {'key': [[1]], 'value': [1]}
+
+    def test_list_fetchnumpy_views(self, duckdb_cursor):
+        import numpy as np
+
+        query = """
+            SELECT
+                CASE WHEN i % 4 = 0 THEN NULL
+                     WHEN i % 4 = 1 THEN [i::FLOAT, NULL]
+                     ELSE range(i % 5)::FLOAT[] END AS l,
+                [i, i + 1, i + 2]::INTEGER[3] AS a
+            FROM range(3000) t(i)
+        """
+        rows = duckdb_cursor.execute(query).fetchall()
+        result = duckdb_cursor.execute(query).fetchnumpy()
+        lists = result['l']
+        for i, (expected, _) in enumerate(rows):
+            if expected is None:
+                assert lists.mask[i]
+            elif None in expected:
+                assert isinstance(lists[i], np.ma.MaskedArray)
+                assert lists[i].mask.tolist() == [item is None for item in expected]
+            else:
+                assert type(lists[i]) is np.ndarray
+                assert lists[i].dtype == np.float32
+                assert lists[i].tolist() == expected
+
+        arrays = result['a']
+        assert arrays[10].tolist() == [10, 11, 12]
+        # the rows are views of a single array holding the children of the whole chunk
+        assert arrays[0].base is not None
+        assert np.shares_memory(arrays[0].base, arrays[1])
@@ -32,3 +32,14 @@ class TestNumpyDatetime64(object):
         rel = duckdb_cursor.sql("select * from arr")
         res = rel.fetchnumpy()['column0']
         np.testing.assert_equal(res, arr)
+
+    @pytest.mark.parametrize('type', ['BOOLEAN', 'TINYINT', 'INTEGER', 'BIGINT', 'UBIGINT', 'FLOAT', 'DOUBLE'])
+    def test_numpy_fixed_width_chunks(self, duckdb_cursor, type):
+        # chunks without NULLs are copied in bulk, make sure they combine with chunks that do contain NULLs
+        res = duckdb_cursor.execute(
+            f"select case when i >= 3000 and i % 7 = 0 then NULL else (i % 100)::{type} end a from range(5000) t(i)"
+        ).fetchnumpy()['a']
+        expected_mask = np.array([i >= 3000 and i % 7 == 0 for i in range(5000)])
+        expected_values = np.array([i % 100 for i in range(5000)]).astype(res.dtype)
+        np.testing.assert_array_equal(np.ma.getmaskarray(res), expected_mask)
+        np.testing.assert_array_equal(res.data[~expected_mask], expected_values[~expected_mask])
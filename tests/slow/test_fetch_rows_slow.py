@@ -0,0 +1,28 @@
+import duckdb
+
+
+class TestFetchRowsSlow(object):
+    def test_fetchall_columnar(self, duckdb_cursor):
+        """The chunk-at-a-time fetchall returns the same rows as the per-row fetchone loop on a mixed-type table"""
+        duckdb_cursor.execute(
+            """
+            CREATE TABLE bench AS
+            SELECT
+                i AS i, i / 7 AS d, i::VARCHAR AS s, i % 2 = 0 AS b,
+                DATE '2000-01-01' + (i % 10000)::INTEGER AS dt,
+                CASE WHEN i % 5 = 0 THEN NULL ELSE i END AS n
+            FROM range(1000000) t(i)
+            """
+        )
+        query = 'SELECT * FROM bench ORDER BY i'
+
+        duckdb_cursor.execute(query)
+        expected = []
+        while True:
+            row = duckdb_cursor.fetchone()
+            if row is None:
+                break
+            expected.append(row)
+
+        result = duckdb_cursor.execute(query).fetchall()
+        assert result == expected
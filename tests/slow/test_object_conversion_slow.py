@@ -0,0 +1,34 @@
+import datetime
+import uuid
+
+import duckdb
+
+
+class TestObjectConversionSlow(object):
+    def test_time_uuid_hugeint_conversion(self, duckdb_cursor):
+        """The objects created directly match the ones built from their string representation"""
+        duckdb_cursor.execute(
+            """
+            CREATE TABLE bench AS
+            SELECT
+                TIME '00:00:00' + to_seconds(i % 86400) AS t,
+                uuid() AS u,
+                i::HUGEINT * 170141183460469231731687303715 AS h,
+                i::UHUGEINT AS uh
+            FROM range(1000000) t(i)
+            """
+        )
+        conversions = [
+            ('t', datetime.time.fromisoformat),
+            ('u', uuid.UUID),
+            ('h', int),
+            ('uh', int),
+        ]
+        for column, from_string in conversions:
+            result = [row[0] for row in duckdb_cursor.execute(f'SELECT {column} FROM bench').fetchall()]
+            strings = duckdb_cursor.execute(f'SELECT {column}::VARCHAR FROM bench').fetchall()
+            expected = [from_string(row[0]) for row in strings]
+            assert result == expected
+
+            arrays = duckdb_cursor.execute(f'SELECT {column} FROM bench').fetchnumpy()
+            assert len(arrays[column]) == len(expected)
@@ -0,0 +1,29 @@
+import duckdb
+import pytest
+
+np = pytest.importorskip('numpy')
+pd = pytest.importorskip('pandas')
+
+
+class TestPandasScanSlow(object):
+    def test_wide_float_nan(self, duckdb_cursor):
+        """Scan a wide float64 DataFrame where a small fraction of the values is NaN"""
+        rows = 1000000
+        columns = 50
+        rng = np.random.default_rng(42)
+        data = {}
+        expected_nulls = []
+        for i in range(columns):
+            column = rng.random(rows)
+            nan_rows = rng.choice(rows, size=rows // 1000, replace=False)
+            column[nan_rows] = np.nan
+            data[f'c{i}'] = column
+            expected_nulls.append(len(nan_rows))
+        df = pd.DataFrame(data)
+        # Built from a row-major 2D array, the columns of this frame are strided views
+        strided_df = pd.DataFrame(np.column_stack(list(data.values())), columns=list(data))
+
+        query = 'SELECT ' + ', '.join(f'COUNT(c{i})' for i in range(columns))
+        for frame in [df, strided_df]:
+            result = duckdb_cursor.sql(f'{query} FROM frame').fetchone()
+            assert list(result) == [rows - nulls for nulls in expected_nulls]